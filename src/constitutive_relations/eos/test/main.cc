@@ -1,4 +1,4 @@
-
+#include <UnitTest++.h>
 #include "Teuchos_GlobalMPISession.hpp"
 
 #include "Teuchos_ParameterList.hpp"
@@ -9,6 +9,9 @@
 #include "eos_factory.hh"
 #include "eos.hh"
 
+#include "viscosity_water_reg.hh"
+#include "viscosity_tabulated_reg.hh"
+
 int main( int argc, char *argv[] )
 {
   Teuchos::GlobalMPISession mpiSession(&argc, &argv);
@@ -24,4 +27,6 @@ int main( int argc, char *argv[] )
 
   Teuchos::RCP<Amanzi::Flow::EOS> eos1 = eosfactory.createEOS(eos1_plist);
   Teuchos::RCP<Amanzi::Flow::EOS> eos2 = eosfactory.createEOS(eos2_plist);
+
+  return UnitTest::RunAllTests();
 }
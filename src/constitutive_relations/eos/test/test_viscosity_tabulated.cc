@@ -0,0 +1,70 @@
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "viscosity_water.hh"
+#include "viscosity_tabulated.hh"
+
+TEST(tabulated_viscosity_water) {
+  using namespace Amanzi::Relations;
+
+  double rel_err = 1.e-8;
+  double T1 = 293.15;
+
+  Teuchos::ParameterList plist;
+  plist.set("viscosity relation type", "tabulated");
+  plist.set("minimum temperature [K]", 250.);
+  plist.set("maximum temperature [K]", 400.);
+  plist.set("maximum relative error [-]", rel_err);
+  Teuchos::ParameterList& water_list = plist.sublist("tabulated viscosity relation");
+  water_list.set("viscosity relation type", "liquid water");
+
+  ViscosityTabulated tab(plist);
+  ViscosityWater water(water_list);
+
+  // viscosity and its derivative are within the bound across the table
+  std::vector<double> temps;
+  for (double T = 250.; T <= 400.; T += 0.37) temps.push_back(T);
+
+  // and on either side of the switch in correlations, where the derivative
+  // has a kink
+  for (double dT : { 1.e-7, 1.e-3, 1.e-2 }) {
+    temps.push_back(T1 - dT);
+    temps.push_back(T1 + dT);
+  }
+
+  for (double T : temps) {
+    double mu = water.Viscosity(T);
+    CHECK_CLOSE(tab.Viscosity(T), mu, rel_err * std::abs(mu));
+    double dmu = water.DViscosityDT(T);
+    CHECK_CLOSE(tab.DViscosityDT(T), dmu, rel_err * std::abs(dmu) + 1.e-15);
+  }
+
+  // the breakpoint itself is a node of the table
+  CHECK_CLOSE(tab.Viscosity(T1), water.Viscosity(T1), rel_err * water.Viscosity(T1));
+
+  // outside of the table, the wrapped model is used
+  CHECK_EQUAL(tab.Viscosity(240.), water.Viscosity(240.));
+  CHECK_EQUAL(tab.DViscosityDT(240.), water.DViscosityDT(240.));
+  CHECK_EQUAL(tab.Viscosity(410.), water.Viscosity(410.));
+  CHECK_EQUAL(tab.DViscosityDT(410.), water.DViscosityDT(410.));
+}
+
+
+TEST(viscosity_water_derivative) {
+  using namespace Amanzi::Relations;
+
+  Teuchos::ParameterList plist;
+  plist.set("viscosity relation type", "liquid water");
+  ViscosityWater water(plist);
+
+  // the derivative matches a centered difference on both correlations,
+  // away from the switch at 293.15 K
+  double eps = 1.e-4;
+  for (double T : { 255., 273.15, 285., 293., 293.3, 310., 350., 395. }) {
+    double fd = (water.Viscosity(T + eps) - water.Viscosity(T - eps)) / (2*eps);
+    double dmu = water.DViscosityDT(T);
+    CHECK(dmu < 0.);
+    CHECK_CLOSE(dmu, fd, 1.e-6 * std::abs(fd));
+  }
+}
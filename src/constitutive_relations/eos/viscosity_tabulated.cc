@@ -0,0 +1,41 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/*
+  ATS
+
+  Tabulated viscosity, wrapping any other viscosity relation.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include "viscosity_relation_factory.hh"
+#include "viscosity_tabulated.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+ViscosityTabulated::ViscosityTabulated(Teuchos::ParameterList& visc_plist)
+{
+  Teuchos::ParameterList& wrapped_plist = visc_plist.sublist("tabulated viscosity relation");
+  ViscosityRelationFactory fac;
+  visc_ = fac.createViscosity(wrapped_plist);
+
+  double T_min = visc_plist.get<double>("minimum temperature [K]", 250.);
+  double T_max = visc_plist.get<double>("maximum temperature [K]", 400.);
+  double rel_err = visc_plist.get<double>("maximum relative error [-]", 1.e-8);
+
+  // liquid water switches correlations at 293.15 K
+  Teuchos::Array<double> default_breakpoints;
+  if (wrapped_plist.get<std::string>("viscosity relation type") == "liquid water")
+    default_breakpoints.push_back(293.15);
+  auto breakpoints = visc_plist.get<Teuchos::Array<double> >("breakpoints [K]",
+          default_breakpoints).toVector();
+
+  table_ = Teuchos::rcp(new TabulatedFunction(
+      [this](double T) { return visc_->Viscosity(T); },
+      [this](double T) { return visc_->DViscosityDT(T); },
+      T_min, T_max, rel_err, breakpoints));
+};
+
+} // namespace
+} // namespace
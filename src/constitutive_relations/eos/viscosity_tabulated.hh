@@ -0,0 +1,72 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/*
+  ATS
+
+  Tabulated viscosity, wrapping any other viscosity relation.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+The wrapped relation is sampled at setup onto an adaptive table, see
+TabulatedFunction, which then serves viscosity and its derivative within the
+given temperature range.  Outside of that range the wrapped relation is
+called directly.
+
+* `"tabulated viscosity relation`" ``[viscosity-relation-spec]`` The relation
+  to tabulate.
+
+* `"minimum temperature [K]`" ``[double]`` **250.**
+
+* `"maximum temperature [K]`" ``[double]`` **400.**
+
+* `"maximum relative error [-]`" ``[double]`` **1.e-8** Bound on the error
+  of both viscosity and its derivative, checked against the wrapped relation
+  at setup.
+
+* `"breakpoints [K]`" ``[Array(double)]`` Temperatures at which the wrapped
+  relation is not smooth.  Defaults to **{293.15}** for `"liquid water`",
+  which switches correlations there, and to **{}** otherwise.
+
+*/
+
+#ifndef AMANZI_RELATIONS_VISCOSITY_TABULATED_HH_
+#define AMANZI_RELATIONS_VISCOSITY_TABULATED_HH_
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "Factory.hh"
+#include "TabulatedFunction.hh"
+#include "viscosity_relation.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+class ViscosityTabulated : public ViscosityRelation {
+
+public:
+  explicit
+  ViscosityTabulated(Teuchos::ParameterList& visc_plist);
+
+  virtual double Viscosity(double T) {
+    return table_->InRange(T) ? table_->Value(T) : visc_->Viscosity(T);
+  }
+  virtual double DViscosityDT(double T) {
+    return table_->InRange(T) ? table_->Derivative(T) : visc_->DViscosityDT(T);
+  }
+
+protected:
+  Teuchos::RCP<ViscosityRelation> visc_;
+  Teuchos::RCP<TabulatedFunction> table_;
+
+ private:
+  static Utils::RegisteredFactory<ViscosityRelation,ViscosityTabulated> factory_;
+
+};
+
+} // namespace
+} // namespace
+
+#endif
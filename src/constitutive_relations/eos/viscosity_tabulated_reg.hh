@@ -0,0 +1,21 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+/*
+  ATS
+
+  Tabulated viscosity, wrapping any other viscosity relation.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include "viscosity_tabulated.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+// registry of method
+Utils::RegisteredFactory<ViscosityRelation,ViscosityTabulated>
+ViscosityTabulated::factory_("tabulated");
+
+} // namespace
+} // namespace
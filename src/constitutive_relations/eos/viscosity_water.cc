@@ -60,7 +60,7 @@ double ViscosityWater::DViscosityDT(double T) {
 
   } else {
     double A = (kbv2_ + kcv2_*dT)*dT;
-    double dA_dT = kbv2_ + 2*kcv2_*dT;
+    double dA_dT = -(kbv2_ + 2*kcv2_*dT);
     xi = A/(T - 168.15);
     dxi_dT = dA_dT / (T-168.15) - A * std::pow(T-168.15, -2);
   }
@@ -7,6 +7,7 @@
   Authors: Ahmad Jan (jana@ornl.gov)
 */
 
+#include "ColumnTopology.hh"
 #include "ColumnSumEvaluator.hh"
 
 namespace Amanzi {
@@ -76,15 +77,14 @@ ColumnSumEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   Key domain = Keys::getDomain(my_key_);
   assert(!domain.empty());
 
-  Teuchos::RCP<const AmanziMesh::Mesh> subsurf_mesh = S->GetMesh();
-  for (int c=0; c!=res_c.MyLength(); ++c) {
-    double sum = 0;
-    for (auto i : subsurf_mesh->cells_of_column(c)) {
-      sum += dep_c[0][i]*cv[0][i] / (mld[0][i] * surf_cv[0][c]);
-    }
-    res_c[0][c] = sum;
-  }
- 
+  const ColumnTopology& cols = GetColumnTopology(S->GetMesh());
+  AMANZI_ASSERT(cols.num_columns() == res_c.MyLength());
+  ColumnSum(cols, [&](int k) {
+      int i = cols.cell(k);
+      return dep_c[0][i]*cv[0][i] / mld[0][i];
+    }, res_c[0]);
+  for (int c=0; c!=res_c.MyLength(); ++c) res_c[0][c] /= surf_cv[0][c];
+
 }
 
 
@@ -0,0 +1,221 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! ColumnTopology caches columns of a mesh in CSR form for column reductions.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+/*!
+
+Column diagnostics (column sums, averages over a depth, thaw depth, water
+table) reduce a cell quantity over each column.  Rather than each evaluator
+walking cells_of_column() and face centroids on its own, the columns of a mesh
+are flattened once into CSR arrays: column col covers entries k in
+[begin(col), end(col)), ordered top to bottom, and entry k is cell cell(k),
+whose top and bottom faces are at depth_top(k) and depth_bottom(k) below the
+top of the column.
+
+Two kinds of meshes are supported:
+
+- a mesh on which build_columns() has been called, whose columns are given
+  by cells_of_column() and faces_of_column(), and
+- a single column mesh, whose cell i lies between faces i and i+1.
+
+Topology is fixed, but the depths are copied from face centroids and so must
+be refreshed with UpdateGeometry() on deformable meshes.  Instances are shared
+through GetColumnTopology(), which stores them on the mesh's RCP so that they
+are destroyed along with the mesh.  A topology keeps no reference to its mesh.
+
+The segmented reductions below run over all columns at once, one column per
+iteration.  Functors are passed the CSR entry k.  Columns are independent, so
+when ATS is built with OpenMP (ATS_ENABLE_OPENMP) the columns are divided
+among threads; functors must then be safe to call concurrently, as are reads
+of vectors.
+
+*/
+
+#ifndef AMANZI_RELATIONS_COLUMN_TOPOLOGY_HH_
+#define AMANZI_RELATIONS_COLUMN_TOPOLOGY_HH_
+
+#include <string>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Mesh.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+class ColumnTopology {
+
+ public:
+  ColumnTopology(const AmanziMesh::Mesh& mesh, bool single_column)
+  {
+    if (single_column) {
+      int ncells = mesh.num_entities(AmanziMesh::CELL,
+              AmanziMesh::Parallel_type::OWNED);
+      offsets_ = { 0, ncells };
+      cells_.resize(ncells);
+      face_top_.resize(ncells);
+      face_bottom_.resize(ncells);
+      for (int i=0; i!=ncells; ++i) {
+        cells_[i] = i;
+        face_top_[i] = i;
+        face_bottom_[i] = i+1;
+      }
+    } else {
+      int ncols = mesh.num_columns(false);
+      offsets_.resize(ncols+1);
+      offsets_[0] = 0;
+      for (int col=0; col!=ncols; ++col) {
+        const auto& col_cells = mesh.cells_of_column(col);
+        const auto& col_faces = mesh.faces_of_column(col);
+        int ncol_cells = col_cells.size();
+        for (int i=0; i!=ncol_cells; ++i) {
+          cells_.push_back(col_cells[i]);
+          face_top_.push_back(col_faces[i]);
+          face_bottom_.push_back(col_faces[i+1]);
+        }
+        offsets_[col+1] = cells_.size();
+      }
+    }
+    UpdateGeometry(mesh);
+  }
+
+  int num_columns() const { return offsets_.size() - 1; }
+  int begin(int col) const { return offsets_[col]; }
+  int end(int col) const { return offsets_[col+1]; }
+
+  int cell(int k) const { return cells_[k]; }
+  double depth_top(int k) const { return depth_top_[k]; }
+  double depth_bottom(int k) const { return depth_bottom_[k]; }
+  double dz(int k) const { return depth_bottom_[k] - depth_top_[k]; }
+
+  // Recompute depths from the current face centroids of the mesh this
+  // topology was built on.
+  void UpdateGeometry(const AmanziMesh::Mesh& mesh) {
+    int z_dir = mesh.space_dimension() - 1;
+    depth_top_.resize(cells_.size());
+    depth_bottom_.resize(cells_.size());
+    for (int col=0; col!=num_columns(); ++col) {
+      if (begin(col) == end(col)) continue;
+      double z_top = mesh.face_centroid(face_top_[begin(col)])[z_dir];
+      for (int k=begin(col); k!=end(col); ++k) {
+        depth_top_[k] = z_top - mesh.face_centroid(face_top_[k])[z_dir];
+        depth_bottom_[k] = z_top - mesh.face_centroid(face_bottom_[k])[z_dir];
+      }
+    }
+  }
+
+ private:
+  std::vector<int> offsets_;
+  std::vector<int> cells_;
+  std::vector<int> face_top_, face_bottom_;
+  std::vector<double> depth_top_, depth_bottom_;
+};
+
+
+// Shared topology of a mesh, built on first use and stored on the mesh.
+inline ColumnTopology&
+GetColumnTopology(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                  bool single_column=false)
+{
+  const std::string name(single_column ? "single column topology" : "column topology");
+  auto cols = Teuchos::get_optional_extra_data<Teuchos::RCP<ColumnTopology> >(mesh, name);
+  if (cols.is_null()) {
+    Teuchos::RCP<const AmanziMesh::Mesh> mesh_node(mesh);
+    Teuchos::set_extra_data(Teuchos::rcp(new ColumnTopology(*mesh, single_column)), name,
+                            Teuchos::outArg(mesh_node), Teuchos::PRE_DESTROY);
+    cols = Teuchos::get_optional_extra_data<Teuchos::RCP<ColumnTopology> >(mesh, name);
+  }
+  return **cols;
+}
+
+
+// res[col] = sum of f(k) over the column
+template<class F>
+void ColumnSum(const ColumnTopology& cols, const F& f, double* res)
+{
+  int ncols = cols.num_columns();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int col=0; col<ncols; ++col) {
+    double sum = 0.;
+    for (int k=cols.begin(col); k!=cols.end(col); ++k) sum += f(k);
+    res[col] = sum;
+  }
+}
+
+
+// res[col] = sum of w(k)*f(k) / sum of w(k) over the column, or 0 if the
+// weights sum to 0
+template<class F, class W>
+void ColumnWeightedAverage(const ColumnTopology& cols, const F& f, const W& w,
+                           double* res)
+{
+  int ncols = cols.num_columns();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int col=0; col<ncols; ++col) {
+    double sum = 0., wsum = 0.;
+    for (int k=cols.begin(col); k!=cols.end(col); ++k) {
+      double wk = w(k);
+      sum += wk * f(k);
+      wsum += wk;
+    }
+    res[col] = wsum > 0. ? sum / wsum : 0.;
+  }
+}
+
+
+// res[col] = depth_top(k) of the first (shallowest) k in the column for
+// which pred(k), or missing if there is none
+template<class P>
+void ColumnFirstCrossingDepth(const ColumnTopology& cols, const P& pred,
+                              double missing, double* res)
+{
+  int ncols = cols.num_columns();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int col=0; col<ncols; ++col) {
+    res[col] = missing;
+    for (int k=cols.begin(col); k!=cols.end(col); ++k) {
+      if (pred(k)) {
+        res[col] = cols.depth_top(k);
+        break;
+      }
+    }
+  }
+}
+
+
+// res[col] = depth_bottom(k) of the last (deepest) k in the column for
+// which pred(k), or missing if there is none
+template<class P>
+void ColumnLastCrossingDepth(const ColumnTopology& cols, const P& pred,
+                             double missing, double* res)
+{
+  int ncols = cols.num_columns();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (int col=0; col<ncols; ++col) {
+    res[col] = missing;
+    for (int k=cols.end(col); k!=cols.begin(col); --k) {
+      if (pred(k-1)) {
+        res[col] = cols.depth_bottom(k-1);
+        break;
+      }
+    }
+  }
+}
+
+} // namespace
+} // namespace
+
+#endif
@@ -48,22 +48,26 @@ SubgridAggregateEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
         const Teuchos::Ptr<CompositeVector>& result)
 {
 
-  int ncells = S->GetMesh("surface_star")->num_entities(AmanziMesh::CELL,
-                                                        AmanziMesh::Parallel_type::OWNED);
-
-  for (int c =0; c < ncells; c++) {
-    std::stringstream name;
-    int id = S->GetMesh(domain_)->cell_map(false).GID(c);
-    name << "surface_column_"<< id;
-    Key source_key = Keys::getKey(name.str(),var_key_);
+  // column keys are fixed by the mesh, so are built once
+  if (source_keys_.empty()) {
+    int ncells = S->GetMesh("surface_star")->num_entities(AmanziMesh::CELL,
+            AmanziMesh::Parallel_type::OWNED);
+    const Epetra_Map& cell_map = S->GetMesh(domain_)->cell_map(false);
+    source_keys_.resize(ncells);
+    for (int c=0; c!=ncells; ++c) {
+      std::stringstream name;
+      name << "surface_column_" << cell_map.GID(c);
+      source_keys_[c] = Keys::getKey(name.str(), var_key_);
+    }
+  }
 
-    const auto& source = *S->GetFieldData(source_key)->ViewComponent("cell",false);
-    
+  Epetra_MultiVector& result_c = *result->ViewComponent("cell", false);
+  int ncells = source_keys_.size();
+  for (int c=0; c!=ncells; ++c) {
+    const auto& source = *S->GetFieldData(source_keys_[c])->ViewComponent("cell",false);
     AMANZI_ASSERT(source.MyLength() == 1);
-    (*result->ViewComponent("cell", false))[0][c] = source[0][0];
-    
+    result_c[0][c] = source[0][0];
   }
-
 }
 
 void
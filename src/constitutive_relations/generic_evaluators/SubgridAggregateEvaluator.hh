@@ -61,6 +61,9 @@ class SubgridAggregateEvaluator : public SecondaryVariableFieldEvaluator {
   Key var_key_;
   Key source_key_;
 
+  // per-column source keys, in order of the owned surface_star cells
+  std::vector<Key> source_keys_;
+
  private:
   static Utils::RegisteredFactory<FieldEvaluator,SubgridAggregateEvaluator> factory_;
 };
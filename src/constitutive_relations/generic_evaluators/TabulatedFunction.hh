@@ -0,0 +1,238 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! TabulatedFunction replaces a smooth 1D function by an error-bounded table.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+/*!
+
+Many constitutive relations are smooth functions of a single variable whose
+evaluation is dominated by transcendental math (pow, exp, log).  This class
+samples such a function and its derivative once, at setup, and serves both by
+cubic Hermite interpolation.
+
+Nodes are placed adaptively: starting from a coarse uniform grid, each
+interval is bisected until the interpolated value and derivative match the
+function at interior test points to within
+
+  |error| <= rel_err * max(|g(x)|, 1.e-3 * max |g|),
+
+for g the function or its derivative, where the floor keeps the bound
+meaningful near zeros of g and the maximum is over all points sampled.  The
+derivative is additionally allowed the roundoff of differencing f over an
+interval of width h, about eps * max |f| / h.  Once built, the table is checked against the
+function on a separate, denser set of points, and construction fails if the
+bound is not met there.
+
+Functions with a kink, such as piecewise models, cannot be resolved by
+bisection alone.  Their locations may be given as breakpoints, which are
+always nodes of the table; derivatives at a breakpoint are taken one-sided.
+
+Lookup costs a bucket index, a short scan, and a cubic.  Callers should fall back to the
+function itself outside of [x_min, x_max].
+
+*/
+
+#ifndef AMANZI_RELATIONS_TABULATED_FUNCTION_HH_
+#define AMANZI_RELATIONS_TABULATED_FUNCTION_HH_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "errors.hh"
+
+namespace Amanzi {
+namespace Relations {
+
+class TabulatedFunction {
+
+ public:
+  template<class F, class DF>
+  TabulatedFunction(const F& f, const DF& df, double x_min, double x_max,
+                    double rel_err, std::vector<double> breakpoints=std::vector<double>(),
+                    int max_intervals=100000) :
+      rel_err_(rel_err),
+      max_intervals_(max_intervals)
+  {
+    if (!(x_max > x_min) || !(rel_err > 0.)) {
+      Errors::Message msg;
+      msg << "TabulatedFunction: invalid range [" << x_min << "," << x_max
+          << "] or relative error " << rel_err;
+      Exceptions::amanzi_throw(msg);
+    }
+
+    // coarse grid, including the breakpoints
+    std::vector<double> coarse;
+    const int n_coarse = 16;
+    for (int i=0; i<=n_coarse; ++i) coarse.push_back(x_min + (x_max - x_min) * i / n_coarse);
+    for (double xb : breakpoints) {
+      if (xb > x_min && xb < x_max) coarse.push_back(xb);
+    }
+    std::sort(coarse.begin(), coarse.end());
+    coarse.erase(std::unique(coarse.begin(), coarse.end()), coarse.end());
+    std::sort(breakpoints.begin(), breakpoints.end());
+
+    // floors of the relative error, grown as the function is sampled
+    f_scale_ = 0.;
+    df_scale_ = 0.;
+
+    double min_width = 1.e-10 * (x_max - x_min);
+    for (int i=0; i!=(int) coarse.size()-1; ++i) {
+      Refine_(f, df, coarse[i], coarse[i+1], min_width, breakpoints);
+    }
+    x_.push_back(coarse.back());
+    BuildIndex_();
+
+    Verify_(f, df);
+  }
+
+  double x_min() const { return x_.front(); }
+  double x_max() const { return x_.back(); }
+  bool InRange(double x) const { return x >= x_.front() && x <= x_.back(); }
+
+  // number of intervals in the table
+  int size() const { return x_.size() - 1; }
+
+  double Value(double x) const { return Value_(Interval_(x), x); }
+  double Derivative(double x) const { return Derivative_(Interval_(x), x); }
+
+ private:
+  double Value_(int i, double x) const {
+    double h = x_[i+1] - x_[i];
+    double t = (x - x_[i]) / h;
+    const double* c = &coefs_[4*i];
+    double t2 = t*t, t3 = t2*t;
+    return (2*t3 - 3*t2 + 1) * c[0] + (t3 - 2*t2 + t) * h * c[1]
+        + (-2*t3 + 3*t2) * c[2] + (t3 - t2) * h * c[3];
+  }
+
+  double Derivative_(int i, double x) const {
+    double h = x_[i+1] - x_[i];
+    double t = (x - x_[i]) / h;
+    const double* c = &coefs_[4*i];
+    double t2 = t*t;
+    return (6*t2 - 6*t) / h * c[0] + (3*t2 - 4*t + 1) * c[1]
+        + (-6*t2 + 6*t) / h * c[2] + (3*t2 - 2*t) * c[3];
+  }
+
+  // Derivatives at a breakpoint are evaluated just inside the interval, so
+  // that piecewise functions pick the branch of that interval.
+  static double OneSided_(double x, double x_min, double x_max,
+                          const std::vector<double>& breakpoints, bool from_right) {
+    if (!std::binary_search(breakpoints.begin(), breakpoints.end(), x)) return x;
+    return from_right ? std::nextafter(x, x_max) : std::nextafter(x, x_min);
+  }
+
+  // Intervals are found through a uniform bucket grid over the range, each
+  // bucket pointing to the first interval that overlaps it, followed by a
+  // short forward scan.  This avoids a binary search per lookup.
+  void BuildIndex_() {
+    int nb = 4 * size();
+    bucket_dx_inv_ = nb / (x_.back() - x_.front());
+    index_.resize(nb+1);
+    int i = 0;
+    for (int b=0; b<=nb; ++b) {
+      double xb = x_.front() + b / bucket_dx_inv_;
+      while (i < size()-1 && x_[i+1] <= xb) ++i;
+      index_[b] = i;
+    }
+  }
+
+  int Interval_(double x) const {
+    int b = (int) ((x - x_.front()) * bucket_dx_inv_);
+    b = std::min(std::max(b, 0), (int) index_.size() - 1);
+    int i = index_[b];
+    while (i < size()-1 && x_[i+1] <= x) ++i;
+    return i;
+  }
+
+  bool Close_(double approx, double exact, double scale, double rel_err,
+              double abs_err=0.) const {
+    return std::abs(approx - exact) <= rel_err * std::max(std::abs(exact), scale) + abs_err;
+  }
+
+  // roundoff in the derivative of a cubic through values of size max |f|
+  double RoundoffErr_(double h) const {
+    return 16. * std::numeric_limits<double>::epsilon() * 1.e3 * f_scale_ / h;
+  }
+
+  template<class F, class DF>
+  void Refine_(const F& f, const DF& df, double a, double b, double min_width,
+               const std::vector<double>& breakpoints) {
+    // Append [a,b] to the table, bisecting until it is accurate.  Intervals
+    // are pushed in order, so the nodes stay sorted.
+    x_.push_back(a);
+    coefs_.push_back(f(a));
+    coefs_.push_back(df(OneSided_(a, a, b, breakpoints, true)));
+    coefs_.push_back(f(b));
+    coefs_.push_back(df(OneSided_(b, a, b, breakpoints, false)));
+    x_.push_back(b);
+
+    // refine to half the tolerance, leaving a margin for points between the
+    // test points
+    bool ok = true;
+    double tol = 0.5 * rel_err_;
+    int i = x_.size() - 2;
+    for (double s : { 0.25, 0.5, 0.75 }) {
+      double x = a + s * (b - a);
+      double fx = f(x), dfx = df(x);
+      f_scale_ = std::max(f_scale_, 1.e-3 * std::abs(fx));
+      df_scale_ = std::max(df_scale_, 1.e-3 * std::abs(dfx));
+      ok &= Close_(Value_(i, x), fx, f_scale_, tol)
+          && Close_(Derivative_(i, x), dfx, df_scale_, tol, RoundoffErr_(b - a));
+    }
+    x_.pop_back();
+    if (ok) return;
+
+    x_.pop_back();
+    coefs_.resize(coefs_.size() - 4);
+    if (b - a < min_width || (int) x_.size() >= max_intervals_) {
+      Errors::Message msg;
+      msg << "TabulatedFunction: cannot reach relative error " << rel_err_
+          << " near x = " << a << "; the function may have a kink there, which "
+          << "should be given as a breakpoint.";
+      Exceptions::amanzi_throw(msg);
+    }
+    double m = a + 0.5 * (b - a);
+    Refine_(f, df, a, m, min_width, breakpoints);
+    Refine_(f, df, m, b, min_width, breakpoints);
+  }
+
+  template<class F, class DF>
+  void Verify_(const F& f, const DF& df) const {
+    // check on points distinct from those used in the refinement
+    for (int i=0; i!=size(); ++i) {
+      for (double s : { 0.1, 0.37, 0.62, 0.9 }) {
+        double x = x_[i] + s * (x_[i+1] - x_[i]);
+        if (!Close_(Value(x), f(x), f_scale_, rel_err_) ||
+            !Close_(Derivative(x), df(x), df_scale_, rel_err_, RoundoffErr_(x_[i+1] - x_[i]))) {
+          Errors::Message msg;
+          msg << "TabulatedFunction: table does not meet relative error " << rel_err_
+              << " at x = " << x << ": value " << Value(x) << " (exact " << f(x)
+              << "), derivative " << Derivative(x) << " (exact " << df(x) << ")";
+          Exceptions::amanzi_throw(msg);
+        }
+      }
+    }
+  }
+
+ private:
+  double rel_err_;
+  int max_intervals_;
+  double f_scale_, df_scale_;
+
+  std::vector<double> x_;      // nodes
+  std::vector<double> coefs_;  // f, df at the left and right of each interval
+  std::vector<int> index_;     // first interval of each bucket
+  double bucket_dx_inv_;
+};
+
+} // namespace
+} // namespace
+
+#endif
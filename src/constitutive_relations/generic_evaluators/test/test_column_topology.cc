@@ -0,0 +1,84 @@
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "Teuchos_RCP.hpp"
+#include "AmanziComm.hh"
+#include "MeshFactory.hh"
+
+#include "ColumnTopology.hh"
+
+using namespace Amanzi;
+using namespace Amanzi::Relations;
+
+// A 2 x 1 x 3 box of unit cubes: two columns of three cells each.
+struct ColumnMesh {
+  ColumnMesh() {
+    auto comm = getDefaultComm();
+    AmanziMesh::MeshFactory factory(comm);
+    Teuchos::RCP<AmanziMesh::Mesh> m = factory.create(0.0, 0.0, 0.0, 2.0, 1.0, 3.0, 2, 1, 3);
+    m->build_columns();
+    mesh = m;
+  }
+
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh;
+};
+
+
+TEST_FIXTURE(ColumnMesh, ColumnTopologyCSR) {
+  const ColumnTopology& cols = GetColumnTopology(mesh);
+  CHECK_EQUAL(mesh->num_columns(false), cols.num_columns());
+
+  for (int col=0; col!=cols.num_columns(); ++col) {
+    CHECK_EQUAL(3, cols.end(col) - cols.begin(col));
+    const auto& col_cells = mesh->cells_of_column(col);
+    for (int k=cols.begin(col); k!=cols.end(col); ++k) {
+      int i = k - cols.begin(col);
+      CHECK_EQUAL(col_cells[i], cols.cell(k));
+      CHECK_CLOSE((double) i, cols.depth_top(k), 1.e-10);
+      CHECK_CLOSE((double) i+1, cols.depth_bottom(k), 1.e-10);
+      CHECK_CLOSE(1.0, cols.dz(k), 1.e-10);
+    }
+  }
+
+  // shared per mesh
+  CHECK(&cols == &GetColumnTopology(mesh));
+}
+
+
+TEST_FIXTURE(ColumnMesh, ColumnReductions) {
+  const ColumnTopology& cols = GetColumnTopology(mesh);
+  int ncols = cols.num_columns();
+  std::vector<double> res(ncols);
+
+  // sum of cell volumes is the column height
+  ColumnSum(cols, [&](int k) { return mesh->cell_volume(cols.cell(k)); }, &res[0]);
+  for (int col=0; col!=ncols; ++col) CHECK_CLOSE(3.0, res[col], 1.e-10);
+
+  // average of top depths 0, 1, 2, weighted by dz
+  ColumnWeightedAverage(cols, [&](int k) { return cols.depth_top(k); },
+                        [&](int k) { return cols.dz(k); }, &res[0]);
+  for (int col=0; col!=ncols; ++col) CHECK_CLOSE(1.0, res[col], 1.e-10);
+
+  // weighted only by the bottom cell
+  ColumnWeightedAverage(cols, [&](int k) { return cols.depth_top(k); },
+                        [&](int k) { return k == cols.end(0) - 1 ? 1. : 0.; }, &res[0]);
+  CHECK_CLOSE(2.0, res[0], 1.e-10);
+  for (int col=1; col<ncols; ++col) CHECK_CLOSE(0.0, res[col], 1.e-10);
+
+  // shallowest cell whose top is below 0.5 starts at depth 1
+  ColumnFirstCrossingDepth(cols, [&](int k) { return cols.depth_top(k) >= 0.5; },
+                           -1.0, &res[0]);
+  for (int col=0; col!=ncols; ++col) CHECK_CLOSE(1.0, res[col], 1.e-10);
+
+  // deepest cell whose bottom is above 2.5 ends at depth 2
+  ColumnLastCrossingDepth(cols, [&](int k) { return cols.depth_bottom(k) <= 2.5; },
+                          -1.0, &res[0]);
+  for (int col=0; col!=ncols; ++col) CHECK_CLOSE(2.0, res[col], 1.e-10);
+
+  // no crossing
+  ColumnFirstCrossingDepth(cols, [](int) { return false; }, -1.0, &res[0]);
+  for (int col=0; col!=ncols; ++col) CHECK_CLOSE(-1.0, res[col], 1.e-10);
+  ColumnLastCrossingDepth(cols, [](int) { return false; }, -1.0, &res[0]);
+  for (int col=0; col!=ncols; ++col) CHECK_CLOSE(-1.0, res[col], 1.e-10);
+}
@@ -48,12 +48,17 @@ Coordinator::Coordinator(Teuchos::ParameterList& parameter_list,
     parameter_list_(Teuchos::rcp(new Teuchos::ParameterList(parameter_list))),
     S_(S),
     comm_(comm),
-    restart_(false) {
+    restart_(false),
+    report_commit_bytes_(false),
+    bytes_per_state_(0.),
+    cycle_bytes_copied_(0.),
+    total_bytes_copied_(0.) {
 
   // create and start the global timer
   timer_ = Teuchos::rcp(new Teuchos::Time("wallclock_monitor",true));
   setup_timer_ = Teuchos::TimeMonitor::getNewCounter("setup");
   cycle_timer_ = Teuchos::TimeMonitor::getNewCounter("cycle");
+  commit_timer_ = Teuchos::TimeMonitor::getNewCounter("state commit");
   coordinator_init();
 
   vo_ = Teuchos::rcp(new Amanzi::VerboseObject("Coordinator", *parameter_list_));
@@ -264,6 +269,7 @@ void Coordinator::initialize() {
   } else {
     S_inter_ = S_;
   }
+  bytes_per_state_ = state_bytes_(*S_);
 
   // set the states in the PKs Passing null for S_ allows for safer subcycling
   // -- PKs can't use it, so it is guaranteed to be pristinely the old
@@ -398,6 +404,36 @@ void Coordinator::read_parameter_list() {
   // restart control
   restart_ = coordinator_list_->isParameter("restart from checkpoint file");
   if (restart_) restart_filename_ = coordinator_list_->get<std::string>("restart from checkpoint file");
+
+  report_commit_bytes_ = coordinator_list_->get<bool>("report state commit bytes", false);
+}
+
+
+// -----------------------------------------------------------------------------
+// Local storage, in bytes, of all fields in a state.
+// -----------------------------------------------------------------------------
+double Coordinator::state_bytes_(const Amanzi::State& S) const {
+  double doubles_count(0.0);
+  for (Amanzi::State::field_iterator field=S.field_begin(); field!=S.field_end(); ++field) {
+    doubles_count += static_cast<double>(field->second->GetLocalElementCount());
+  }
+  return doubles_count * sizeof(double);
+}
+
+
+// -----------------------------------------------------------------------------
+// Copy one state into another, keeping a tally of the bytes copied.
+//
+// Without subcycling, S_inter_ is the same object as S_, so commit and
+// rollback copy into S_inter_ only when it is a separate state; see
+// advance().
+// -----------------------------------------------------------------------------
+void Coordinator::copy_state_(const Amanzi::State& source, Amanzi::State& target) {
+  if (&source == &target) return;
+
+  Teuchos::TimeMonitor monitor(*commit_timer_);
+  target = source;
+  cycle_bytes_copied_ += bytes_per_state_;
 }
 
 
@@ -450,8 +486,8 @@ bool Coordinator::advance(double t_old, double t_new) {
     checkpoint(dt);
 
     // we're done with this time step, copy the state
-    *S_ = *S_next_;
-    *S_inter_ = *S_next_;
+    copy_state_(*S_next_, *S_);
+    if (S_inter_ != S_) copy_state_(*S_next_, *S_inter_);
 
   } else {
     // Failed the timestep.
@@ -462,8 +498,8 @@ bool Coordinator::advance(double t_old, double t_new) {
     }
 
     // The timestep sizes have been updated, so copy back old soln and try again.
-    *S_next_ = *S_;
-    *S_inter_ = *S_;
+    copy_state_(*S_, *S_next_);
+    if (S_inter_ != S_) copy_state_(*S_, *S_inter_);
 
     // check whether meshes are deformable, and if so, recover the old coordinates
     for (Amanzi::State::mesh_iterator mesh=S_->mesh_begin();
@@ -587,9 +623,18 @@ void Coordinator::cycle_driver() {
       S_->set_final_time(S_->time() + dt);
       S_->set_intermediate_time(S_->time());
 
+      cycle_bytes_copied_ = 0.;
       fail = advance(S_->time(), S_->time() + dt);
       dt = get_dt(fail);
 
+      total_bytes_copied_ += cycle_bytes_copied_;
+      if (report_commit_bytes_ && vo_->os_OK(Teuchos::VERB_HIGH)) {
+        Teuchos::OSTab tab = vo_->getOSTab();
+        *vo_->os() << "State commit: copied " << cycle_bytes_copied_/1024/1024
+                   << " MBytes this cycle (" << total_bytes_copied_/1024/1024
+                   << " MBytes total)" << std::endl;
+      }
+
     } // while not finished
 
 
@@ -619,6 +664,13 @@ void Coordinator::cycle_driver() {
   // finalizing simulation
   WriteStateStatistics(*S_, *vo_);
   report_memory();
+  double global_bytes_copied(0.0);
+  comm_->SumAll(&total_bytes_copied_, &global_bytes_copied, 1);
+  if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "State commit/rollback copied " << std::setw(7)
+               << global_bytes_copied/1024/1024 << " MBytes (total over all cores)" << std::endl;
+  }
   Teuchos::TimeMonitor::summarize(*vo_->os());
 
   finalize();
@@ -43,6 +43,9 @@ simulation, including starting and ending times and restart options.
       minimized.
     * `"PK tree`" ``[pk-typed-spec-list]`` List of length one, the top level
       PK_ spec.
+    * `"report state commit bytes`" ``[bool]`` **false** If true, report, at
+      high verbosity, the number of bytes copied between the old, intermediate
+      and new states at the end of each cycle.
 
 Note: Either `"end cycle`" or `"end time`" are required, and if
 both are present, the simulation will stop with whichever arrives
@@ -123,6 +126,11 @@ private:
   void coordinator_init();
   void read_parameter_list();
 
+  // Copies all data from one state to another, skipping the copy when the
+  // two are the same object.  Keeps a tally of the bytes copied.
+  void copy_state_(const Amanzi::State& source, Amanzi::State& target);
+  double state_bytes_(const Amanzi::State& S) const;
+
   // PK container and factory
   Teuchos::RCP<Amanzi::PK> pk_;
 
@@ -163,8 +171,15 @@ private:
   // timers
   Teuchos::RCP<Teuchos::Time> setup_timer_;
   Teuchos::RCP<Teuchos::Time> cycle_timer_;
+  Teuchos::RCP<Teuchos::Time> commit_timer_;
   Teuchos::RCP<Teuchos::Time> timer_;
   double duration_;
+
+  // state commit/rollback accounting
+  bool report_commit_bytes_;
+  double bytes_per_state_;
+  double cycle_bytes_copied_;
+  double total_bytes_copied_;
   
   // fancy OS
   Teuchos::RCP<Amanzi::VerboseObject> vo_;
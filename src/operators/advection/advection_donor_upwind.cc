@@ -8,6 +8,8 @@
    Donor upwind advection.
    ------------------------------------------------------------------------- */
 
+#include "face_cell_adjacency.hh"
+#include "halo_exchange.hh"
 #include "advection_donor_upwind.hh"
 
 namespace Amanzi {
@@ -35,15 +37,17 @@ void AdvectionDonorUpwind::Apply(const Teuchos::RCP<Functions::BoundaryFunction>
 
   // Part 1: Collect fluxes in faces
   {
-    field_->ScatterMasterToGhosted("cell"); // communicate the cells
-    const Epetra_MultiVector& field_c = *field_->ViewComponent("cell", true);
+    // communicate the cells and fluxes, overlapped with interior faces
+    Epetra_MultiVector& field_c = *field_->ViewComponent("cell", true);
     Epetra_MultiVector& field_f = *field_->ViewComponent("face", true);
+    ScopedHaloExchange cell_halo(GetHaloExchange(mesh_, AmanziMesh::CELL), field_c);
 
-    flux_->ScatterMasterToGhosted("face");
+    // flux_ is const, but as with ScatterMasterToGhosted() its ghosts are not
     const Epetra_MultiVector& flux = *flux_->ViewComponent("face",true);
+    ScopedHaloExchange face_halo(GetHaloExchange(mesh_, AmanziMesh::FACE),
+                                 const_cast<Epetra_MultiVector&>(flux));
 
-    unsigned int nfaces_ghosted = field_f.MyLength();
-    for (unsigned int f=0; f!=nfaces_ghosted; ++f) {  // loop over master and slave faces
+    auto collect = [&](int f) {
       int c1 = (*upwind_cell_)[f];
       if (c1 >=0) {
         double u = std::abs(flux[0][f]);
@@ -51,7 +55,17 @@ void AdvectionDonorUpwind::Apply(const Teuchos::RCP<Functions::BoundaryFunction>
           field_f[i][f] = u * field_c[i][c1];
         }
       }
-    }
+    };
+
+    const FaceCellAdjacency& adj = GetFaceCellAdjacency(mesh_);
+    for (int f : adj.interior_faces()) collect(f);
+
+    cell_halo.End();
+    face_halo.End();
+    for (int f : adj.halo_faces()) collect(f);
+
+    int nfaces_ghosted = field_f.MyLength();
+    for (int f=adj.size_owned(); f!=nfaces_ghosted; ++f) collect(f);  // slave faces
   }
 
   // Part 2: put fluxes in cell
@@ -89,19 +103,18 @@ void AdvectionDonorUpwind::IdentifyUpwindCells_() {
   upwind_cell_->PutValue(-1);
   downwind_cell_->PutValue(-1);
 
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> fdirs;
-
   flux_->ScatterMasterToGhosted("face");
   const Epetra_MultiVector& flux_f = *flux_->ViewComponent("face",true);
 
-  unsigned int ncells_used = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::ALL);
-  for (unsigned int c=0; c!=ncells_used; ++c) {
-    mesh_->cell_get_faces_and_dirs(c, &faces, &fdirs);
+  const FaceCellAdjacency& adj = GetFaceCellAdjacency(mesh_);
+  int nfaces = adj.size();
+  for (int f=0; f!=nfaces; ++f) {
+    for (int j=0; j!=2; ++j) {
+      int i = adj.sorted_index(f, j);
+      int c = adj.cell(f, i);
+      if (c < 0) continue;
 
-    for (unsigned int i=0; i!=faces.size(); ++i) {
-      AmanziMesh::Entity_ID f = faces[i];
-      if (flux_f[0][f] * fdirs[i] >= 0) {
+      if (flux_f[0][f] * adj.dir(f, i) >= 0) {
         (*upwind_cell_)[f] = c;
       } else {
         (*downwind_cell_)[f] = c;
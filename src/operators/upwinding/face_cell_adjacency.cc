@@ -0,0 +1,154 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// A cache of face -> (cell0, cell1, dir0, dir1) adjacency.
+// -----------------------------------------------------------------------------
+
+#include <cmath>
+#include <string>
+
+#include "dbc.hh"
+#include "OperatorDefs.hh"
+#include "face_cell_adjacency.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+FaceCellAdjacency::FaceCellAdjacency(const AmanziMesh::Mesh& mesh)
+{
+  nfaces_ = mesh.num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
+  cells_.assign(2*nfaces_, -1);
+  dirs_.assign(2*nfaces_, 0);
+
+  AmanziMesh::Entity_ID_List cells;
+  for (int f=0; f!=nfaces_; ++f) {
+    mesh.face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+    AMANZI_ASSERT(cells.size() >= 1 && cells.size() <= 2);
+    for (int i=0; i!=cells.size(); ++i) cells_[2*f+i] = cells[i];
+  }
+
+  AmanziMesh::Entity_ID_List faces;
+  std::vector<int> fdirs;
+  int ncells = mesh.num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::ALL);
+  for (int c=0; c!=ncells; ++c) {
+    mesh.cell_get_faces_and_dirs(c, &faces, &fdirs);
+    for (int n=0; n!=faces.size(); ++n) {
+      int f = faces[n];
+      int i = cells_[2*f] == c ? 0 : 1;
+      AMANZI_ASSERT(cells_[2*f+i] == c);
+      dirs_[2*f+i] = fdirs[n];
+    }
+  }
+
+  nfaces_owned_ = mesh.num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+  int ncells_owned = mesh.num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  owned_cells_.resize(2*nfaces_owned_);
+  for (int f=0; f!=nfaces_owned_; ++f) {
+    int c0 = cells_[2*f];
+    int c1 = cells_[2*f+1];
+    bool owned0 = c0 < ncells_owned;
+    bool owned1 = c1 >= 0 && c1 < ncells_owned;
+    if ((c1 < 0 || owned1) && owned0) {
+      interior_faces_.push_back(f);
+    } else {
+      halo_faces_.push_back(f);
+    }
+
+    // an owned face should have an owned cell, but fall back to the ghost
+    if (owned0 && !owned1) c1 = c0;
+    else if (owned1 && !owned0) c0 = c1;
+    else if (c1 < 0) c1 = c0;
+    owned_cells_[2*f] = c0;
+    owned_cells_[2*f+1] = c1;
+  }
+}
+
+
+void FaceCellAdjacency::IdentifyUpwindCells(const Epetra_MultiVector& flux, int nfaces,
+        std::vector<int>& upwind_cell, std::vector<int>& downwind_cell) const
+{
+  AMANZI_ASSERT(nfaces <= nfaces_);
+  upwind_cell.resize(nfaces);
+  downwind_cell.resize(nfaces);
+
+  for (int f=0; f!=nfaces; ++f) {
+    // visit cells in increasing local ID so that zero flux ties are broken
+    // consistently
+    int uw = -1;
+    int dw = -1;
+    for (int j=0; j!=2; ++j) {
+      int i = sorted_index(f, j);
+      int c = cells_[2*f+i];
+      if (c < 0) continue;
+
+      double tmp = flux[0][f] * dirs_[2*f+i];
+      if (tmp > 0) {
+        uw = c;
+      } else if (tmp < 0) {
+        dw = c;
+      } else if (uw == -1) {
+        uw = c;
+      } else {
+        dw = c;
+      }
+    }
+    upwind_cell[f] = uw;
+    downwind_cell[f] = dw;
+  }
+}
+
+
+const FaceCellAdjacency&
+GetFaceCellAdjacency(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+{
+  // Stored as extra data on the mesh's RCP node, so that the adjacency is
+  // destroyed along with the mesh rather than outliving it in a static.
+  const std::string name("face cell adjacency");
+  auto adj = Teuchos::get_optional_extra_data<Teuchos::RCP<FaceCellAdjacency> >(mesh, name);
+  if (adj.is_null()) {
+    Teuchos::RCP<const AmanziMesh::Mesh> mesh_node(mesh);
+    Teuchos::set_extra_data(Teuchos::rcp(new FaceCellAdjacency(*mesh)), name,
+                            Teuchos::outArg(mesh_node), Teuchos::PRE_DESTROY);
+    adj = Teuchos::get_optional_extra_data<Teuchos::RCP<FaceCellAdjacency> >(mesh, name);
+  }
+  return **adj;
+}
+
+
+void AddUpwindAdvectionResidual(const std::vector<int>& upwind_cell,
+        const std::vector<int>& downwind_cell, const Epetra_MultiVector& flux_f,
+        const Epetra_MultiVector& h_c, const std::vector<int>& bc_model,
+        const std::vector<double>& bc_value, Epetra_MultiVector& res_c)
+{
+  int nfaces = upwind_cell.size();
+  AMANZI_ASSERT(downwind_cell.size() == upwind_cell.size());
+  AMANZI_ASSERT(nfaces <= flux_f.MyLength());
+  const double* h = h_c[0];
+  double* res = res_c[0];
+
+  for (int f=0; f!=nfaces; ++f) {
+    int uw = upwind_cell[f];
+    int dw = downwind_cell[f];
+    double q = std::abs(flux_f[0][f]);
+
+    if (uw >= 0) {
+      double adv = q * h[uw];
+      res[uw] += adv;
+      if (dw >= 0) res[dw] -= adv;
+    } else if (bc_model[f] == OPERATOR_BC_DIRICHLET) {
+      // inflow of the boundary value
+      res[dw] -= q * bc_value[f];
+    } else {
+      // inflow without a Dirichlet condition, as in PDE_AdvectionUpwind
+      res[dw] += q * h[dw];
+    }
+  }
+}
+
+} // namespace
+} // namespace
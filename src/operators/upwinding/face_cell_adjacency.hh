@@ -0,0 +1,118 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+// Author: Ethan Coon (ecoon@lanl.gov)
+//
+// A cache of face -> (cell0, cell1, dir0, dir1) adjacency, owned by the mesh
+// and shared by all of its users.
+//
+// Upwinding schemes and transport PKs identify upwind and downwind cells of
+// every face on every call.  Walking cell_get_faces_and_dirs() to do so
+// requires mesh queries and allocations per cell; this flattens that
+// information once so that upwind identification becomes a streaming pass
+// over faces.
+//
+// Cells of a face are stored in the order of face_get_cells(), on the
+// ghosted mesh.  Faces with only one cell have cell1 = -1.  dir_i is the
+// orientation of the face's normal relative to the outward normal of cell_i,
+// as given by cell_get_faces_and_dirs().
+//
+// Owned faces are also classified as interior, if all of their cells are
+// owned, or halo, if any is a ghost.  Kernels over faces may process interior
+// faces while ghost cell values are still being communicated; see
+// halo_exchange.hh.
+//
+// This is purely topological, so it is unchanged by mesh deformation.
+// -----------------------------------------------------------------------------
+
+#ifndef AMANZI_UPWINDING_FACE_CELL_ADJACENCY_
+#define AMANZI_UPWINDING_FACE_CELL_ADJACENCY_
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Epetra_MultiVector.h"
+
+#include "Mesh.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+class FaceCellAdjacency {
+
+ public:
+  explicit FaceCellAdjacency(const AmanziMesh::Mesh& mesh);
+
+  // number of faces, including ghosts
+  int size() const { return nfaces_; }
+
+  // number of owned faces
+  int size_owned() const { return nfaces_owned_; }
+
+  // owned faces whose cells are all owned
+  const std::vector<int>& interior_faces() const { return interior_faces_; }
+
+  // owned faces with a ghost cell
+  const std::vector<int>& halo_faces() const { return halo_faces_; }
+
+  // i-th owned cell of owned face f (i = 0 or 1).  If f has only one owned
+  // cell, both are that cell, so that e.g. a min over the owned cells of a
+  // face needs no branch.
+  int owned_cell(int f, int i) const { return owned_cells_[2*f+i]; }
+
+  // i-th cell of face f (i = 0 or 1), or -1
+  int cell(int f, int i) const { return cells_[2*f+i]; }
+
+  // orientation of face f relative to the i-th cell
+  int dir(int f, int i) const { return dirs_[2*f+i]; }
+
+  // index i of the j-th cell of face f, ordered by increasing local ID.
+  // Visiting cells in this order reproduces the order of a loop over cells.
+  int sorted_index(int f, int j) const {
+    int i0 = (cells_[2*f+1] >= 0 && cells_[2*f+1] < cells_[2*f]) ? 1 : 0;
+    return (i0 + j) % 2;
+  }
+
+  // Identifies upwind and downwind cells of faces [0,nfaces) given a face
+  // flux.  Either may be -1 on the boundary.  When the flux is zero, the cell
+  // with the lower local ID is chosen as upwind.
+  void IdentifyUpwindCells(const Epetra_MultiVector& flux, int nfaces,
+                           std::vector<int>& upwind_cell,
+                           std::vector<int>& downwind_cell) const;
+
+ private:
+  int nfaces_, nfaces_owned_;
+  std::vector<int> cells_;
+  std::vector<int> dirs_;
+  std::vector<int> interior_faces_, halo_faces_;
+  std::vector<int> owned_cells_;
+};
+
+
+// Access the adjacency for a mesh, which is built on first use and shared
+// by all subsequent callers.  It is attached to the mesh's RCP, and so lives
+// exactly as long as the mesh.
+const FaceCellAdjacency&
+GetFaceCellAdjacency(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+
+// Adds the first order upwind advective residual of h into res, as the
+// assembled PDE_AdvectionUpwind would with Dirichlet BCs applied on inflow:
+// each owned face carries |q| h_upwind out of its upwind cell and into its
+// downwind cell.  An inflow boundary face takes the Dirichlet value if it
+// has one, else the value of its cell.  upwind_cell and downwind_cell cover
+// the owned faces, as given by IdentifyUpwindCells().  h_c must have ghost
+// values, and res_c is summed into on owned and ghost cells, so it must be
+// gathered to owned cells afterwards.
+void AddUpwindAdvectionResidual(const std::vector<int>& upwind_cell,
+        const std::vector<int>& downwind_cell, const Epetra_MultiVector& flux_f,
+        const Epetra_MultiVector& h_c, const std::vector<int>& bc_model,
+        const std::vector<double>& bc_value, Epetra_MultiVector& res_c);
+
+} // namespace
+} // namespace
+
+#endif
@@ -0,0 +1,134 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+//
+// A split-phase owned -> ghost communication of cell or face values.
+// -----------------------------------------------------------------------------
+
+#include <string>
+
+#include "Epetra_Distributor.h"
+
+#include "dbc.hh"
+#include "errors.hh"
+#include "halo_exchange.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+HaloExchange::HaloExchange(const Epetra_BlockMap& owned_map,
+                           const Epetra_BlockMap& ghosted_map) :
+    importer_(ghosted_map, owned_map),
+    v_(NULL),
+    recvs_(NULL),
+    len_recvs_(0)
+{
+  parallel_ = owned_map.Comm().NumProc() > 1;
+
+  // owned entries lead the ghosted map, so that only ghosts are received
+  AMANZI_ASSERT(importer_.NumSameIDs() == owned_map.NumMyElements());
+  AMANZI_ASSERT(importer_.NumPermuteIDs() == 0);
+}
+
+
+HaloExchange::~HaloExchange()
+{
+  // messages must not arrive in a freed buffer
+  if (v_ != NULL) Abandon();
+  delete [] recvs_;
+}
+
+
+void HaloExchange::Begin(Epetra_MultiVector& v)
+{
+  AMANZI_ASSERT(v_ == NULL);
+  AMANZI_ASSERT(v.Map().SameAs(importer_.TargetMap()));
+  v_ = &v;
+  if (!parallel_) return;
+
+  int nvecs = v.NumVectors();
+  int nsends = importer_.NumExportIDs();
+  const int* send_lids = importer_.ExportLIDs();
+  sends_.resize(nsends * nvecs);
+  for (int k=0; k!=nsends; ++k) {
+    for (int i=0; i!=nvecs; ++i) sends_[k*nvecs + i] = v[i][send_lids[k]];
+  }
+
+  int ierr = importer_.Distributor().DoPosts(reinterpret_cast<char*>(sends_.data()),
+          nvecs * sizeof(double), len_recvs_, recvs_);
+  if (ierr) {
+    Errors::Message msg("HaloExchange: posting the ghost exchange failed.");
+    Exceptions::amanzi_throw(msg);
+  }
+}
+
+
+void HaloExchange::End()
+{
+  AMANZI_ASSERT(v_ != NULL);
+  Epetra_MultiVector& v = *v_;
+  v_ = NULL;
+  if (!parallel_) return;
+
+  int ierr = importer_.Distributor().DoWaits();
+  if (ierr) {
+    Errors::Message msg("HaloExchange: waiting on the ghost exchange failed.");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  int nvecs = v.NumVectors();
+  int nrecvs = importer_.NumRemoteIDs();
+  const int* recv_lids = importer_.RemoteLIDs();
+  const double* recvs = reinterpret_cast<const double*>(recvs_);
+  for (int k=0; k!=nrecvs; ++k) {
+    for (int i=0; i!=nvecs; ++i) v[i][recv_lids[k]] = recvs[k*nvecs + i];
+  }
+}
+
+
+void HaloExchange::Abandon()
+{
+  AMANZI_ASSERT(v_ != NULL);
+  v_ = NULL;
+  if (!parallel_) return;
+
+  // the posted messages must still be completed before they are reposted
+  importer_.Distributor().DoWaits();
+}
+
+
+HaloExchange&
+GetHaloExchange(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                AmanziMesh::Entity_kind kind)
+{
+  std::string name;
+  if (kind == AmanziMesh::CELL) {
+    name = "cell halo exchange";
+  } else if (kind == AmanziMesh::FACE) {
+    name = "face halo exchange";
+  } else {
+    Errors::Message msg("HaloExchange: only CELL and FACE exchanges are supported.");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  // Stored as extra data on the mesh's RCP node, as is FaceCellAdjacency.
+  auto halo = Teuchos::get_optional_extra_data<Teuchos::RCP<HaloExchange> >(mesh, name);
+  if (halo.is_null()) {
+    Teuchos::RCP<HaloExchange> new_halo;
+    if (kind == AmanziMesh::CELL) {
+      new_halo = Teuchos::rcp(new HaloExchange(mesh->cell_map(false), mesh->cell_map(true)));
+    } else {
+      new_halo = Teuchos::rcp(new HaloExchange(mesh->face_map(false), mesh->face_map(true)));
+    }
+    Teuchos::RCP<const AmanziMesh::Mesh> mesh_node(mesh);
+    Teuchos::set_extra_data(new_halo, name, Teuchos::outArg(mesh_node), Teuchos::PRE_DESTROY);
+    halo = Teuchos::get_optional_extra_data<Teuchos::RCP<HaloExchange> >(mesh, name);
+  }
+  return **halo;
+}
+
+} // namespace
+} // namespace
@@ -0,0 +1,120 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+
+// -----------------------------------------------------------------------------
+// ATS
+//
+// License: see $ATS_DIR/COPYRIGHT
+//
+// A split-phase owned -> ghost communication of cell or face values, shared
+// by all users of a mesh.
+//
+// CompositeVector::ScatterMasterToGhosted() blocks until ghost values have
+// arrived, so kernels that scatter and then loop over faces leave the
+// communication latency fully exposed.  HaloExchange splits the scatter into
+// Begin(), which packs and posts the messages, and End(), which waits for
+// them and writes the ghost entries, so that work not needing ghost values,
+// e.g. over FaceCellAdjacency::interior_faces(), can be done in between:
+//
+//   HaloExchange& halo = GetHaloExchange(mesh, AmanziMesh::CELL);
+//   halo.Begin(*cv.ViewComponent("cell", true));
+//   for (int f : adj.interior_faces()) ...
+//   halo.End();
+//   for (int f : adj.halo_faces()) ...
+//
+// The vector must be the ghosted view of a component on the mesh's ghosted
+// map, whose owned entries come first.  Only one exchange per mesh and
+// entity kind may be in flight at a time, and the vector must not be
+// modified between Begin() and End().
+//
+// If an exception may be thrown between Begin() and End(), use a
+// ScopedHaloExchange, which finishes an exchange left in flight when it goes
+// out of scope, so that the shared exchange can be used again:
+//
+//   ScopedHaloExchange halo(GetHaloExchange(mesh, AmanziMesh::CELL),
+//                           *cv.ViewComponent("cell", true));
+//   for (int f : adj.interior_faces()) ...
+//   halo.End();
+// -----------------------------------------------------------------------------
+
+#ifndef AMANZI_UPWINDING_HALO_EXCHANGE_
+#define AMANZI_UPWINDING_HALO_EXCHANGE_
+
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Epetra_Import.h"
+#include "Epetra_MultiVector.h"
+
+#include "Mesh.hh"
+
+namespace Amanzi {
+namespace Operators {
+
+class HaloExchange {
+
+ public:
+  HaloExchange(const Epetra_BlockMap& owned_map, const Epetra_BlockMap& ghosted_map);
+  ~HaloExchange();
+
+  // Packs owned entries of v and posts the exchange of its ghost entries.
+  void Begin(Epetra_MultiVector& v);
+
+  // Waits for the exchange posted by Begin() and writes the ghost entries.
+  void End();
+
+  // Is an exchange posted by Begin() waiting for End()?
+  bool in_flight() const { return v_ != NULL; }
+
+  // Waits for the exchange posted by Begin() without writing the ghost
+  // entries, and without throwing.  For abandoning an exchange on error.
+  void Abandon();
+
+ private:
+  HaloExchange(const HaloExchange& other) = delete;
+  HaloExchange& operator=(const HaloExchange& other) = delete;
+
+  Epetra_Import importer_;
+  bool parallel_;
+
+  Epetra_MultiVector* v_;
+  std::vector<double> sends_;
+  char* recvs_;
+  int len_recvs_;
+};
+
+
+// Begin()s an exchange on construction, and Abandon()s it on destruction if
+// End() has not been called.
+class ScopedHaloExchange {
+
+ public:
+  ScopedHaloExchange(HaloExchange& halo, Epetra_MultiVector& v) :
+      halo_(halo) {
+    halo_.Begin(v);
+  }
+
+  ~ScopedHaloExchange() {
+    if (halo_.in_flight()) halo_.Abandon();
+  }
+
+  void End() { halo_.End(); }
+
+ private:
+  ScopedHaloExchange(const ScopedHaloExchange& other) = delete;
+  ScopedHaloExchange& operator=(const ScopedHaloExchange& other) = delete;
+
+  HaloExchange& halo_;
+};
+
+
+// Access the exchange of entities of kind (CELL or FACE) on a mesh, which is
+// built on first use and shared by all subsequent callers.  It is attached
+// to the mesh's RCP, and so lives exactly as long as the mesh.
+HaloExchange&
+GetHaloExchange(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh,
+                AmanziMesh::Entity_kind kind);
+
+} // namespace
+} // namespace
+
+#endif
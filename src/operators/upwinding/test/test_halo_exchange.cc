@@ -0,0 +1,124 @@
+#include <stdexcept>
+#include "UnitTest++.h"
+
+#include "Teuchos_RCP.hpp"
+#include "Epetra_Import.h"
+#include "Epetra_MultiVector.h"
+
+#include "AmanziComm.hh"
+#include "MeshFactory.hh"
+
+#include "halo_exchange.hh"
+
+using namespace Amanzi;
+using namespace Amanzi::Operators;
+
+namespace {
+
+// Fills owned entries with a function of the global ID, and ghost entries
+// with garbage.
+void Fill(Epetra_MultiVector& v, int nowned) {
+  for (int i=0; i!=v.NumVectors(); ++i) {
+    for (int k=0; k!=v.MyLength(); ++k) {
+      v[i][k] = k < nowned ? 10.0 * v.Map().GID(k) + i : -1.e10;
+    }
+  }
+}
+
+// Checks that Begin()/End() writes the same ghost entries as an Import.
+void CheckExchange(const Epetra_BlockMap& owned_map, const Epetra_BlockMap& ghosted_map,
+                   HaloExchange& halo, int nvecs) {
+  int nowned = owned_map.NumMyElements();
+  Epetra_MultiVector v(ghosted_map, nvecs);
+  Fill(v, nowned);
+
+  Epetra_MultiVector owned(owned_map, nvecs);
+  for (int i=0; i!=nvecs; ++i) {
+    for (int k=0; k!=nowned; ++k) owned[i][k] = v[i][k];
+  }
+  Epetra_MultiVector expected(ghosted_map, nvecs);
+  Epetra_Import importer(ghosted_map, owned_map);
+  expected.Import(owned, importer, Insert);
+
+  halo.Begin(v);
+  CHECK(halo.in_flight());
+  halo.End();
+  CHECK(!halo.in_flight());
+
+  for (int i=0; i!=nvecs; ++i) {
+    for (int k=0; k!=v.MyLength(); ++k) CHECK_EQUAL(expected[i][k], v[i][k]);
+  }
+}
+
+} // namespace
+
+
+struct BoxMesh {
+  BoxMesh() {
+    AmanziMesh::MeshFactory factory(getDefaultComm());
+    mesh = factory.create(0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 4, 3, 5);
+  }
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh;
+};
+
+
+TEST_FIXTURE(BoxMesh, HALO_EXCHANGE_MATCHES_IMPORT) {
+  HaloExchange& cell_halo = GetHaloExchange(mesh, AmanziMesh::CELL);
+  HaloExchange& face_halo = GetHaloExchange(mesh, AmanziMesh::FACE);
+  CHECK(&cell_halo == &GetHaloExchange(mesh, AmanziMesh::CELL));
+  CHECK(&cell_halo != &face_halo);
+
+  // reused exchanges, with a varying number of vectors
+  for (int nvecs=1; nvecs!=4; ++nvecs) {
+    CheckExchange(mesh->cell_map(false), mesh->cell_map(true), cell_halo, nvecs);
+    CheckExchange(mesh->face_map(false), mesh->face_map(true), face_halo, nvecs);
+  }
+}
+
+
+// Cell and face exchanges may be in flight together.
+TEST_FIXTURE(BoxMesh, HALO_EXCHANGE_CELL_AND_FACE) {
+  int ncells_owned = mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
+  int nfaces_owned = mesh->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+  Epetra_MultiVector cells(mesh->cell_map(true), 2);
+  Epetra_MultiVector faces(mesh->face_map(true), 1);
+  Fill(cells, ncells_owned);
+  Fill(faces, nfaces_owned);
+
+  ScopedHaloExchange cell_halo(GetHaloExchange(mesh, AmanziMesh::CELL), cells);
+  ScopedHaloExchange face_halo(GetHaloExchange(mesh, AmanziMesh::FACE), faces);
+  face_halo.End();
+  cell_halo.End();
+
+  for (int i=0; i!=cells.NumVectors(); ++i) {
+    for (int k=0; k!=cells.MyLength(); ++k) {
+      CHECK_EQUAL(10.0 * cells.Map().GID(k) + i, cells[i][k]);
+    }
+  }
+  for (int k=0; k!=faces.MyLength(); ++k) {
+    CHECK_EQUAL(10.0 * faces.Map().GID(k), faces[0][k]);
+  }
+}
+
+
+// An exception thrown between Begin() and End() must not leave the shared
+// exchange in flight.
+TEST_FIXTURE(BoxMesh, HALO_EXCHANGE_SCOPED_THROW) {
+  HaloExchange& halo = GetHaloExchange(mesh, AmanziMesh::CELL);
+  Epetra_MultiVector v(mesh->cell_map(true), 1);
+  Fill(v, mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED));
+
+  bool thrown = false;
+  try {
+    ScopedHaloExchange scoped(halo, v);
+    CHECK(halo.in_flight());
+    throw std::runtime_error("between Begin and End");
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  CHECK(thrown);
+  CHECK(!halo.in_flight());
+
+  // and the exchange is usable again
+  CheckExchange(mesh->cell_map(false), mesh->cell_map(true), halo, 2);
+}
@@ -0,0 +1,96 @@
+#include <cmath>
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+
+#include "AmanziComm.hh"
+#include "MeshFactory.hh"
+#include "CompositeVector.hh"
+#include "CompositeVectorSpace.hh"
+#include "BCs.hh"
+#include "OperatorDefs.hh"
+#include "Operator.hh"
+#include "PDE_AdvectionUpwind.hh"
+
+#include "face_cell_adjacency.hh"
+
+using namespace Amanzi;
+
+// The matrix-free upwind residual used by EnergyBase must match the
+// assembled PDE_AdvectionUpwind, with BCs applied as EnergyBase did before,
+// for a flux with inflow through both Dirichlet and non-Dirichlet boundary
+// faces.
+TEST(UPWIND_ADVECTION_RESIDUAL_MATCHES_ASSEMBLED) {
+  auto comm = getDefaultComm();
+  AmanziMesh::MeshFactory factory(comm);
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh =
+      factory.create(0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 4, 3, 5);
+
+  // a nonuniform flux: inflow through x = 0 and y = 0
+  CompositeVectorSpace flux_space;
+  flux_space.SetMesh(mesh)->SetGhosted()->SetComponent("face", AmanziMesh::FACE, 1);
+  CompositeVector flux(flux_space);
+  {
+    Epetra_MultiVector& flux_f = *flux.ViewComponent("face", false);
+    for (int f=0; f!=flux_f.MyLength(); ++f) {
+      const AmanziGeometry::Point& normal = mesh->face_normal(f);
+      const AmanziGeometry::Point& xf = mesh->face_centroid(f);
+      flux_f[0][f] = (1.0 + xf[2]) * normal[0] + 0.5 * normal[1] - 0.3 * (1.0 + xf[0]) * normal[2];
+    }
+  }
+  flux.ScatterMasterToGhosted("face");
+
+  // Dirichlet on x = 0 only
+  auto bc = Teuchos::rcp(new Operators::BCs(mesh, AmanziMesh::FACE, WhetStone::DOF_Type::SCALAR));
+  int nfaces = mesh->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
+  for (int f=0; f!=nfaces; ++f) {
+    if (std::abs(mesh->face_centroid(f)[0]) < 1.e-10) {
+      bc->bc_model()[f] = Operators::OPERATOR_BC_DIRICHLET;
+      bc->bc_value()[f] = 2.0 + mesh->face_centroid(f)[2];
+    }
+  }
+
+  // assembled
+  Teuchos::ParameterList plist;
+  Operators::PDE_AdvectionUpwind pde(plist, mesh);
+  pde.global_operator()->Init();
+  pde.Setup(flux);
+  pde.SetBCs(bc, bc);
+  pde.UpdateMatrices(Teuchos::ptr(&flux));
+  pde.ApplyBCs(false, true, false);
+
+  CompositeVector h(pde.global_operator()->DomainMap());
+  {
+    Epetra_MultiVector& h_c = *h.ViewComponent("cell", false);
+    for (int c=0; c!=h_c.MyLength(); ++c) {
+      const AmanziGeometry::Point& xc = mesh->cell_centroid(c);
+      h_c[0][c] = 1.0 + xc[0] + 2.0 * xc[1] * xc[1] - xc[2];
+    }
+  }
+  CompositeVector res_assembled(h);
+  res_assembled.PutScalar(0.);
+  pde.global_operator()->ComputeNegativeResidual(h, res_assembled, false);
+
+  // matrix free
+  const Operators::FaceCellAdjacency& adj = Operators::GetFaceCellAdjacency(mesh);
+  const Epetra_MultiVector& flux_f = *flux.ViewComponent("face", false);
+  std::vector<int> uw, dw;
+  adj.IdentifyUpwindCells(flux_f, flux_f.MyLength(), uw, dw);
+
+  CompositeVectorSpace cell_space;
+  cell_space.SetMesh(mesh)->SetGhosted()->SetComponent("cell", AmanziMesh::CELL, 1);
+  CompositeVector res(cell_space);
+  res.PutScalarMasterAndGhosted(0.);
+  h.ScatterMasterToGhosted("cell");
+  Operators::AddUpwindAdvectionResidual(uw, dw, flux_f, *h.ViewComponent("cell", true),
+          bc->bc_model(), bc->bc_value(), *res.ViewComponent("cell", true));
+  res.GatherGhostedToMaster("cell");
+
+  const Epetra_MultiVector& res_c = *res.ViewComponent("cell", false);
+  const Epetra_MultiVector& res_assembled_c = *res_assembled.ViewComponent("cell", false);
+  CHECK_EQUAL(res_assembled_c.MyLength(), res_c.MyLength());
+  for (int c=0; c!=res_c.MyLength(); ++c) {
+    CHECK_CLOSE(res_assembled_c[0][c], res_c[0][c], 1.e-10);
+  }
+}
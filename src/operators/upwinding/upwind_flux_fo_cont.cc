@@ -16,7 +16,6 @@
 #include "Debugger.hh"
 #include "VerboseObject.hh"
 #include "upwind_flux_fo_cont.hh"
-#include "Epetra_IntVector.h"
 
 namespace Amanzi {
 namespace Operators {
@@ -89,40 +88,12 @@ void UpwindFluxFOCont::CalculateCoefficientsOnFaces(
   
   // Identify upwind/downwind cells for each local face.  Note upwind/downwind
   // may be a ghost cell.
-  Epetra_IntVector upwind_cell(*face_coef->ComponentMap("face",true));
-  upwind_cell.PutValue(-1);
-  Epetra_IntVector downwind_cell(*face_coef->ComponentMap("face",true));
-  downwind_cell.PutValue(-1);
-  
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> fdirs;
   int nfaces_local = flux.size("face",false);
-  
-  int ncells = cell_coef.size("cell",true);
-  for (int c=0; c!=ncells; ++c) {
-    mesh->cell_get_faces_and_dirs(c, &faces, &fdirs);
-    
-    for (unsigned int n=0; n!=faces.size(); ++n) {
-      int f = faces[n];
-      
-      if (f < nfaces_local) {
-        if (flux_v[0][f] * fdirs[n] > 0) {
-          upwind_cell[f] = c;
-        } else if (flux_v[0][f] * fdirs[n] < 0) {
-          downwind_cell[f] = c;
-        } else {
-          // We don't care, but we have to get one into upwind and the other
-          // into downwind.
-          if (upwind_cell[f] == -1) {
-            upwind_cell[f] = c;
-          } else {
-            downwind_cell[f] = c;
-          }
-        }
-      }
-    }
-  }
-  
+  GetFaceCellAdjacency(mesh).IdentifyUpwindCells(flux_v, nfaces_local,
+          upwind_cell_, downwind_cell_);
+  const std::vector<int>& upwind_cell = upwind_cell_;
+  const std::vector<int>& downwind_cell = downwind_cell_;
+
   // Determine the face coefficient of local faces.
   // These parameters may be key to a smooth convergence rate near zero flux.
   //  double flow_eps_factor = 1.;
@@ -14,6 +14,7 @@
 #define AMANZI_UPWINDING_FLUXHARMONICMEAN_SCHEME_
 
 #include "upwinding.hh"
+#include "face_cell_adjacency.hh"
 
 namespace Amanzi {
 
@@ -59,6 +60,10 @@ private:
   std::string face_coef_;
   std::string flux_;
   double flux_eps_;
+
+  // workspace for upwind identification
+  std::vector<int> upwind_cell_;
+  std::vector<int> downwind_cell_;
 };
 
 } // namespace
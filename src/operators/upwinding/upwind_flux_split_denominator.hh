@@ -13,6 +13,7 @@
 #define AMANZI_UPWINDING_FLUXSPLITDENOMINATOR_SCHEME_
 
 #include "upwinding.hh"
+#include "face_cell_adjacency.hh"
 
 namespace Amanzi {
 
@@ -70,6 +71,10 @@ private:
   std::string manning_coef_;
   double slope_regularization_;
   std::string ponded_depth_;
+
+  // workspace for upwind identification
+  std::vector<int> upwind_cell_;
+  std::vector<int> downwind_cell_;
 };
 
 } // namespace
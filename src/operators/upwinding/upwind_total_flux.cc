@@ -15,8 +15,8 @@
 #include "State.hh"
 #include "Debugger.hh"
 #include "VerboseObject.hh"
+#include "halo_exchange.hh"
 #include "upwind_total_flux.hh"
-#include "Epetra_IntVector.h"
 
 namespace Amanzi {
 namespace Operators {
@@ -55,53 +55,23 @@ void UpwindTotalFlux::CalculateCoefficientsOnFaces(
     face_coef->ViewComponent("cell",true)->PutScalar(1.0);
   }
 
-  // communicate needed ghost values
-  cell_coef.ScatterMasterToGhosted("cell");
-
   // pull out vectors
   const Epetra_MultiVector& flux_v = *flux.ViewComponent("face",false);
   Epetra_MultiVector& coef_faces = *face_coef->ViewComponent("face",false);
   const Epetra_MultiVector& coef_cells = *cell_coef.ViewComponent("cell",true);
 
+  // communicate needed ghost values, overlapped with interior faces.
+  // cell_coef is const, but as with ScatterMasterToGhosted() its ghosts are not.
+  ScopedHaloExchange halo(GetHaloExchange(mesh, AmanziMesh::CELL),
+                          const_cast<Epetra_MultiVector&>(coef_cells));
+
   // Identify upwind/downwind cells for each local face.  Note upwind/downwind
   // may be a ghost cell.
-  Epetra_IntVector upwind_cell(*face_coef->ComponentMap("face",true));
-  upwind_cell.PutValue(-1);
-  Epetra_IntVector downwind_cell(*face_coef->ComponentMap("face",true));
-  downwind_cell.PutValue(-1);
-
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> fdirs;
+  const FaceCellAdjacency& adj = GetFaceCellAdjacency(mesh);
   int nfaces_local = flux.size("face",false);
-
-  int ncells = cell_coef.size("cell",true);
-  for (int c=0; c!=ncells; ++c) {
-    mesh->cell_get_faces_and_dirs(c, &faces, &fdirs);   
-
-    for (unsigned int n=0; n!=faces.size(); ++n) {
-      int f = faces[n];
-
-      if  (face_coef->HasComponent("cell")) {        
-        (*face_coef->ViewComponent("cell",true))[0][c] = coef_cells[0][c];
-      }
-
-      if (f < nfaces_local) {
-        if (flux_v[0][f] * fdirs[n] > 0) {
-          upwind_cell[f] = c;
-        } else if (flux_v[0][f] * fdirs[n] < 0) {
-          downwind_cell[f] = c;
-        } else {
-          // We don't care, but we have to get one into upwind and the other
-          // into downwind.
-          if (upwind_cell[f] == -1) {
-            upwind_cell[f] = c;
-          } else {
-            downwind_cell[f] = c;
-          }
-        }
-      }
-    }
-  }
+  adj.IdentifyUpwindCells(flux_v, nfaces_local, upwind_cell_, downwind_cell_);
+  const std::vector<int>& upwind_cell = upwind_cell_;
+  const std::vector<int>& downwind_cell = downwind_cell_;
 
   // Determine the face coefficient of local faces.
   // These parameters may be key to a smooth convergence rate near zero flux.
@@ -109,8 +79,7 @@ void UpwindTotalFlux::CalculateCoefficientsOnFaces(
   //  double min_flow_eps = 1.e-8;
   double coefs[2];
 
-  int nfaces = face_coef->size("face",false);
-  for (int f=0; f!=nfaces; ++f) {
+  auto coefficient_on_face = [&](int f) {
     int uw = upwind_cell[f];
     int dw = downwind_cell[f];
     AMANZI_ASSERT(!((uw == -1) && (dw == -1)));
@@ -168,6 +137,18 @@ void UpwindTotalFlux::CalculateCoefficientsOnFaces(
 
       coef_faces[0][f] = coefs[0] * param + coefs[1] * (1. - param);
     }
+  };
+
+  for (int f : adj.interior_faces()) coefficient_on_face(f);
+
+  halo.End();
+  for (int f : adj.halo_faces()) coefficient_on_face(f);
+
+  // copy cell coefficients, including ghosts
+  if (face_coef->HasComponent("cell")) {
+    Epetra_MultiVector& coef_faces_c = *face_coef->ViewComponent("cell",true);
+    int ncells = cell_coef.size("cell",true);
+    for (int c=0; c!=ncells; ++c) coef_faces_c[0][c] = coef_cells[0][c];
   }
 };
 
@@ -203,48 +184,16 @@ UpwindTotalFlux::UpdateDerivatives(const Teuchos::Ptr<State>& S,
 
   // Identify upwind/downwind cells for each local face.  Note upwind/downwind
   // may be a ghost cell.
-  Epetra_IntVector upwind_cell(mesh->face_map(true));
-  upwind_cell.PutValue(-1);
-  Epetra_IntVector downwind_cell(mesh->face_map(true));
-  downwind_cell.PutValue(-1);
-
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> fdirs;
-
-  int ncells = dcell_v.MyLength();
-  for (int c=0; c!=ncells; ++c) {
-    mesh->cell_get_faces_and_dirs(c, &faces, &fdirs);
-
-    for (unsigned int n=0; n!=faces.size(); ++n) {
-      int f = faces[n];
-
-      if (f < nfaces_owned) {
-        if (flux_v[0][f] * fdirs[n] > 0) {
-          upwind_cell[f] = c;
-        } else if (flux_v[0][f] * fdirs[n] < 0) {
-          downwind_cell[f] = c;
-        } else {
-          // We don't care, but we have to get one into upwind and the other
-          // into downwind.
-          if (upwind_cell[f] == -1) {
-            upwind_cell[f] = c;
-          } else {
-            downwind_cell[f] = c;
-          }
-        }
-      }
-    }
-  }
-
+  const FaceCellAdjacency& adj = GetFaceCellAdjacency(mesh);
+  adj.IdentifyUpwindCells(flux_v, nfaces_owned, upwind_cell_, downwind_cell_);
 
   for (unsigned int f=0; f!=nfaces_owned; ++f) {
-    int uw = upwind_cell[f];
-    int dw = downwind_cell[f];
+    int uw = upwind_cell_[f];
+    int dw = downwind_cell_[f];
     AMANZI_ASSERT(!((uw == -1) && (dw == -1)));
 
-    AmanziMesh::Entity_ID_List cells;
-    mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    int mcells = cells.size();
+    int cells[2] = { adj.cell(f,0), adj.cell(f,1) };
+    int mcells = cells[1] < 0 ? 1 : 2;
 
     // uw coef
     if (uw == -1) {
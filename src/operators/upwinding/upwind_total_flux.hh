@@ -14,6 +14,7 @@
 #define AMANZI_UPWINDING_TOTALFLUX_SCHEME_
 
 #include "upwinding.hh"
+#include "face_cell_adjacency.hh"
 
 namespace Amanzi {
 
@@ -60,6 +61,10 @@ private:
   std::string face_coef_;
   std::string flux_;
   double flux_eps_;
+
+  // workspace for upwind identification
+  mutable std::vector<int> upwind_cell_;
+  mutable std::vector<int> downwind_cell_;
 };
 
 } // namespace
@@ -0,0 +1,67 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Flat plans of boundary faces, for applying boundary conditions.
+
+#include <utility>
+
+#include "dbc.hh"
+#include "errors.hh"
+#include "face_cell_adjacency.hh"
+#include "boundary_face_plan.hh"
+
+namespace Amanzi {
+
+BoundaryFacePlan::BoundaryFacePlan(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+{
+  const Operators::FaceCellAdjacency& adj = Operators::GetFaceCellAdjacency(mesh);
+  int nfaces = adj.size();
+  int nfaces_owned = adj.size_owned();
+  index_.assign(nfaces, -1);
+
+  for (int f=0; f!=nfaces; ++f) {
+    if (adj.cell(f, 1) >= 0) continue;
+
+    BoundaryFaceRecord rec;
+    rec.f = f;
+    rec.c = adj.cell(f, 0);
+    rec.dir = adj.dir(f, 0);
+
+    index_[f] = records_.size();
+    records_.push_back(rec);
+    if (f < nfaces_owned) owned_.push_back(rec);
+  }
+}
+
+
+const BoundaryFaceRecord&
+BoundaryFacePlan::Record(AmanziMesh::Entity_ID f) const
+{
+  if (index_[f] < 0) {
+    Errors::Message msg;
+    msg << "BoundaryFacePlan: face " << f << " is not on the boundary.";
+    Exceptions::amanzi_throw(msg);
+  }
+  return records_[index_[f]];
+}
+
+
+const std::vector<BoundaryFaceRecord>&
+BoundaryFacePlan::Records(const Functions::BoundaryFunction& bc)
+{
+  auto plan = plans_.find(&bc);
+  if (plan == plans_.end()) {
+    std::vector<BoundaryFaceRecord> recs;
+    recs.reserve(bc.size());
+    for (const auto& face_value : bc) recs.push_back(Record(face_value.first));
+    plan = plans_.emplace(&bc, std::move(recs)).first;
+  }
+  AMANZI_ASSERT(plan->second.size() == bc.size());
+  return plan->second;
+}
+
+} // namespace
@@ -0,0 +1,86 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Flat plans of boundary faces, for applying boundary conditions.
+
+/*
+  Boundary conditions are updated on every residual and preconditioner
+  evaluation, and most of them need the cell internal to each boundary face,
+  some also the orientation of the face relative to that cell.  Rather than
+  querying the mesh (and allocating lists) for these on each update, they are
+  compiled once, from the mesh's FaceCellAdjacency, into flat records:
+
+    f    the face
+    c    the cell internal to f
+    dir  orientation of f relative to the outward normal of c
+
+  A plan holds a record for every face, owned or ghosted, that has a single
+  cell.  For each BoundaryFunction, the records of its faces are gathered on
+  first use in the order of iteration over that function, so that BCs are
+  applied by streaming over the function and its records together:
+
+    const auto& recs = bc_plan_->Records(*bc_head_);
+    int i = 0;
+    for (const auto& bc : *bc_head_) {
+      const BoundaryFaceRecord& rec = recs[i++];
+      ...
+    }
+
+  Records of a BoundaryFunction are gathered once, so Records() must only be
+  called on a function that has been finalized, after which its faces are
+  fixed.  Records are topological only; geometry such as face areas is still
+  taken from the mesh, which may deform.
+*/
+
+#ifndef ATS_BOUNDARY_FACE_PLAN_HH_
+#define ATS_BOUNDARY_FACE_PLAN_HH_
+
+#include <map>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Mesh.hh"
+#include "BoundaryFunction.hh"
+
+namespace Amanzi {
+
+struct BoundaryFaceRecord {
+  AmanziMesh::Entity_ID f;
+  AmanziMesh::Entity_ID c;
+  int dir;
+};
+
+
+class BoundaryFacePlan {
+
+ public:
+  explicit BoundaryFacePlan(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh);
+
+  // Is f a boundary face?
+  bool IsBoundary(AmanziMesh::Entity_ID f) const { return index_[f] >= 0; }
+
+  // Record of the boundary face f.
+  const BoundaryFaceRecord& Record(AmanziMesh::Entity_ID f) const;
+
+  // Records of all owned boundary faces, in increasing face order.
+  const std::vector<BoundaryFaceRecord>& OwnedRecords() const { return owned_; }
+
+  // Records of the faces of bc, in the order of iteration over bc.  bc must
+  // be finalized.
+  const std::vector<BoundaryFaceRecord>&
+  Records(const Functions::BoundaryFunction& bc);
+
+ private:
+  std::vector<BoundaryFaceRecord> records_;  // all boundary faces
+  std::vector<int> index_;                   // face -> records_ index, or -1
+  std::vector<BoundaryFaceRecord> owned_;
+  std::map<const Functions::BoundaryFunction*, std::vector<BoundaryFaceRecord> > plans_;
+};
+
+} // namespace
+
+#endif
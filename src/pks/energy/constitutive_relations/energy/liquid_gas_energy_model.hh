@@ -10,6 +10,9 @@ Energy for a two-phase, liquid+water vapor evaluator.
 #ifndef AMANZI_ENERGY_LIQUID_GAS_ENERGY_MODEL_HH_
 #define AMANZI_ENERGY_LIQUID_GAS_ENERGY_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace Energy {
 namespace Relations {
@@ -43,6 +46,82 @@ class LiquidGasEnergyModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+LiquidGasEnergyModel::Energy(double phi, double phi0, double sl, double nl, double ul, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*(phi*(ng*sg*ug + nl*sl*ul) + rho_r*ur*(-phi0 + 1));
+}
+
+inline double
+LiquidGasEnergyModel::DEnergyDPorosity(double phi, double phi0, double sl, double nl, double ul, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*(ng*sg*ug + nl*sl*ul);
+}
+
+inline double
+LiquidGasEnergyModel::DEnergyDBasePorosity(double phi, double phi0, double sl, double nl, double ul, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return -cv*rho_r*ur;
+}
+
+inline double
+LiquidGasEnergyModel::DEnergyDSaturationLiquid(double phi, double phi0, double sl, double nl, double ul, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*nl*phi*ul;
+}
+
+inline double
+LiquidGasEnergyModel::DEnergyDMolarDensityLiquid(double phi, double phi0, double sl, double nl, double ul, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*phi*sl*ul;
+}
+
+inline double
+LiquidGasEnergyModel::DEnergyDInternalEnergyLiquid(double phi, double phi0, double sl, double nl, double ul, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*nl*phi*sl;
+}
+
+inline double
+LiquidGasEnergyModel::DEnergyDSaturationGas(double phi, double phi0, double sl, double nl, double ul, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*ng*phi*ug;
+}
+
+inline double
+LiquidGasEnergyModel::DEnergyDMolarDensityGas(double phi, double phi0, double sl, double nl, double ul, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*phi*sg*ug;
+}
+
+inline double
+LiquidGasEnergyModel::DEnergyDInternalEnergyGas(double phi, double phi0, double sl, double nl, double ul, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*ng*phi*sg;
+}
+
+inline double
+LiquidGasEnergyModel::DEnergyDDensityRock(double phi, double phi0, double sl, double nl, double ul, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*ur*(-phi0 + 1);
+}
+
+inline double
+LiquidGasEnergyModel::DEnergyDInternalEnergyRock(double phi, double phi0, double sl, double nl, double ul, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*rho_r*(-phi0 + 1);
+}
+
+inline double
+LiquidGasEnergyModel::DEnergyDCellVolume(double phi, double phi0, double sl, double nl, double ul, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return phi*(ng*sg*ug + nl*sl*ul) + rho_r*ur*(-phi0 + 1);
+}
+
 } //namespace
 } //namespace
 } //namespace
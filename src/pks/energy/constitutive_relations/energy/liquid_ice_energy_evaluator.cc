@@ -130,22 +130,22 @@ Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
 
   for (CompositeVector::name_iterator comp=result->begin();
        comp!=result->end(); ++comp) {
-    const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-    const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-    const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-    const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-    const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-    const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-    const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+    const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+    const double* __restrict phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+    const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+    const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+    const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+    const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+    const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+    const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+    const double* __restrict rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+    const double* __restrict ur_v = (*ur->ViewComponent(*comp, false))[0];
+    const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+    double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
     int ncomp = result->size(*comp, false);
     for (int i=0; i!=ncomp; ++i) {
-      result_v[0][i] = model_->Energy(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
+      result_v[i] = model_->Energy(phi_v[i], phi0_v[i], sl_v[i], nl_v[i], ul_v[i], si_v[i], ni_v[i], ui_v[i], rho_r_v[i], ur_v[i], cv_v[i]);
     }
   }
 }
@@ -170,242 +170,242 @@ Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
   if (wrt_key == phi_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* __restrict ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDPorosity(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDPorosity(phi_v[i], phi0_v[i], sl_v[i], nl_v[i], ul_v[i], si_v[i], ni_v[i], ui_v[i], rho_r_v[i], ur_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == phi0_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* __restrict ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDBasePorosity(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDBasePorosity(phi_v[i], phi0_v[i], sl_v[i], nl_v[i], ul_v[i], si_v[i], ni_v[i], ui_v[i], rho_r_v[i], ur_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == sl_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* __restrict ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDSaturationLiquid(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDSaturationLiquid(phi_v[i], phi0_v[i], sl_v[i], nl_v[i], ul_v[i], si_v[i], ni_v[i], ui_v[i], rho_r_v[i], ur_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == nl_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* __restrict ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityLiquid(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDMolarDensityLiquid(phi_v[i], phi0_v[i], sl_v[i], nl_v[i], ul_v[i], si_v[i], ni_v[i], ui_v[i], rho_r_v[i], ur_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == ul_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* __restrict ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyLiquid(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDInternalEnergyLiquid(phi_v[i], phi0_v[i], sl_v[i], nl_v[i], ul_v[i], si_v[i], ni_v[i], ui_v[i], rho_r_v[i], ur_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == si_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* __restrict ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDSaturationIce(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDSaturationIce(phi_v[i], phi0_v[i], sl_v[i], nl_v[i], ul_v[i], si_v[i], ni_v[i], ui_v[i], rho_r_v[i], ur_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == ni_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* __restrict ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityIce(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDMolarDensityIce(phi_v[i], phi0_v[i], sl_v[i], nl_v[i], ul_v[i], si_v[i], ni_v[i], ui_v[i], rho_r_v[i], ur_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == ui_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* __restrict ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyIce(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDInternalEnergyIce(phi_v[i], phi0_v[i], sl_v[i], nl_v[i], ul_v[i], si_v[i], ni_v[i], ui_v[i], rho_r_v[i], ur_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == rho_r_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* __restrict ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDDensityRock(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDDensityRock(phi_v[i], phi0_v[i], sl_v[i], nl_v[i], ul_v[i], si_v[i], ni_v[i], ui_v[i], rho_r_v[i], ur_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == ur_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* __restrict ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyRock(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDInternalEnergyRock(phi_v[i], phi0_v[i], sl_v[i], nl_v[i], ul_v[i], si_v[i], ni_v[i], ui_v[i], rho_r_v[i], ur_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == cv_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& phi0_v = *phi0->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rho_r_v = *rho_r->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ur_v = *ur->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict phi0_v = (*phi0->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict rho_r_v = (*rho_r->ViewComponent(*comp, false))[0];
+      const double* __restrict ur_v = (*ur->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDCellVolume(phi_v[0][i], phi0_v[0][i], sl_v[0][i], nl_v[0][i], ul_v[0][i], si_v[0][i], ni_v[0][i], ui_v[0][i], rho_r_v[0][i], ur_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDCellVolume(phi_v[i], phi0_v[i], sl_v[i], nl_v[i], ul_v[i], si_v[i], ni_v[i], ui_v[i], rho_r_v[i], ur_v[i], cv_v[i]);
       }
     }
 
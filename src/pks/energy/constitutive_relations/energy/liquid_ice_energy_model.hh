@@ -10,6 +10,9 @@ Energy for a two-phase, liquid+ice evaluator.
 #ifndef AMANZI_ENERGY_LIQUID_ICE_ENERGY_MODEL_HH_
 #define AMANZI_ENERGY_LIQUID_ICE_ENERGY_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace Energy {
 namespace Relations {
@@ -43,6 +46,82 @@ class LiquidIceEnergyModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+LiquidIceEnergyModel::Energy(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double rho_r, double ur, double cv) const
+{
+  return cv*(phi*(ni*si*ui + nl*sl*ul) + rho_r*ur*(-phi0 + 1));
+}
+
+inline double
+LiquidIceEnergyModel::DEnergyDPorosity(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double rho_r, double ur, double cv) const
+{
+  return cv*(ni*si*ui + nl*sl*ul);
+}
+
+inline double
+LiquidIceEnergyModel::DEnergyDBasePorosity(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double rho_r, double ur, double cv) const
+{
+  return -cv*rho_r*ur;
+}
+
+inline double
+LiquidIceEnergyModel::DEnergyDSaturationLiquid(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double rho_r, double ur, double cv) const
+{
+  return cv*nl*phi*ul;
+}
+
+inline double
+LiquidIceEnergyModel::DEnergyDMolarDensityLiquid(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double rho_r, double ur, double cv) const
+{
+  return cv*phi*sl*ul;
+}
+
+inline double
+LiquidIceEnergyModel::DEnergyDInternalEnergyLiquid(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double rho_r, double ur, double cv) const
+{
+  return cv*nl*phi*sl;
+}
+
+inline double
+LiquidIceEnergyModel::DEnergyDSaturationIce(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double rho_r, double ur, double cv) const
+{
+  return cv*ni*phi*ui;
+}
+
+inline double
+LiquidIceEnergyModel::DEnergyDMolarDensityIce(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double rho_r, double ur, double cv) const
+{
+  return cv*phi*si*ui;
+}
+
+inline double
+LiquidIceEnergyModel::DEnergyDInternalEnergyIce(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double rho_r, double ur, double cv) const
+{
+  return cv*ni*phi*si;
+}
+
+inline double
+LiquidIceEnergyModel::DEnergyDDensityRock(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double rho_r, double ur, double cv) const
+{
+  return cv*ur*(-phi0 + 1);
+}
+
+inline double
+LiquidIceEnergyModel::DEnergyDInternalEnergyRock(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double rho_r, double ur, double cv) const
+{
+  return cv*rho_r*(-phi0 + 1);
+}
+
+inline double
+LiquidIceEnergyModel::DEnergyDCellVolume(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double rho_r, double ur, double cv) const
+{
+  return phi*(ni*si*ui + nl*sl*ul) + rho_r*ur*(-phi0 + 1);
+}
+
 } //namespace
 } //namespace
 } //namespace
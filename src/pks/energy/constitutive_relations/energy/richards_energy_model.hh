@@ -10,6 +10,9 @@ Richards energy: the standard form as a function of liquid saturation and specif
 #ifndef AMANZI_ENERGY_RICHARDS_ENERGY_MODEL_HH_
 #define AMANZI_ENERGY_RICHARDS_ENERGY_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace Energy {
 namespace Relations {
@@ -40,6 +43,64 @@ class RichardsEnergyModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+RichardsEnergyModel::Energy(double phi, double phi0, double sl, double nl, double ul, double rho_r, double ur, double cv) const
+{
+  return cv*(nl*phi*sl*ul + rho_r*ur*(-phi0 + 1));
+}
+
+inline double
+RichardsEnergyModel::DEnergyDPorosity(double phi, double phi0, double sl, double nl, double ul, double rho_r, double ur, double cv) const
+{
+  return cv*nl*sl*ul;
+}
+
+inline double
+RichardsEnergyModel::DEnergyDBasePorosity(double phi, double phi0, double sl, double nl, double ul, double rho_r, double ur, double cv) const
+{
+  return -cv*rho_r*ur;
+}
+
+inline double
+RichardsEnergyModel::DEnergyDSaturationLiquid(double phi, double phi0, double sl, double nl, double ul, double rho_r, double ur, double cv) const
+{
+  return cv*nl*phi*ul;
+}
+
+inline double
+RichardsEnergyModel::DEnergyDMolarDensityLiquid(double phi, double phi0, double sl, double nl, double ul, double rho_r, double ur, double cv) const
+{
+  return cv*phi*sl*ul;
+}
+
+inline double
+RichardsEnergyModel::DEnergyDInternalEnergyLiquid(double phi, double phi0, double sl, double nl, double ul, double rho_r, double ur, double cv) const
+{
+  return cv*nl*phi*sl;
+}
+
+inline double
+RichardsEnergyModel::DEnergyDDensityRock(double phi, double phi0, double sl, double nl, double ul, double rho_r, double ur, double cv) const
+{
+  return cv*ur*(-phi0 + 1);
+}
+
+inline double
+RichardsEnergyModel::DEnergyDInternalEnergyRock(double phi, double phi0, double sl, double nl, double ul, double rho_r, double ur, double cv) const
+{
+  return cv*rho_r*(-phi0 + 1);
+}
+
+inline double
+RichardsEnergyModel::DEnergyDCellVolume(double phi, double phi0, double sl, double nl, double ul, double rho_r, double ur, double cv) const
+{
+  return nl*phi*sl*ul + rho_r*ur*(-phi0 + 1);
+}
+
 } //namespace
 } //namespace
 } //namespace
@@ -95,18 +95,18 @@ Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
 
   for (CompositeVector::name_iterator comp=result->begin();
        comp!=result->end(); ++comp) {
-    const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-    const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-    const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-    const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+    const double* __restrict h_v = (*h->ViewComponent(*comp, false))[0];
+    const double* __restrict eta_v = (*eta->ViewComponent(*comp, false))[0];
+    const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+    const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+    const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+    const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+    const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+    double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
     int ncomp = result->size(*comp, false);
     for (int i=0; i!=ncomp; ++i) {
-      result_v[0][i] = model_->Energy(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
+      result_v[i] = model_->Energy(h_v[i], eta_v[i], nl_v[i], ul_v[i], ni_v[i], ui_v[i], cv_v[i]);
     }
   }
 }
@@ -127,126 +127,126 @@ Teuchos::RCP<const CompositeVector> cv = S->GetFieldData(cv_key_);
   if (wrt_key == h_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict h_v = (*h->ViewComponent(*comp, false))[0];
+      const double* __restrict eta_v = (*eta->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDPondedDepth(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDPondedDepth(h_v[i], eta_v[i], nl_v[i], ul_v[i], ni_v[i], ui_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == eta_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict h_v = (*h->ViewComponent(*comp, false))[0];
+      const double* __restrict eta_v = (*eta->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDUnfrozenFraction(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDUnfrozenFraction(h_v[i], eta_v[i], nl_v[i], ul_v[i], ni_v[i], ui_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == nl_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict h_v = (*h->ViewComponent(*comp, false))[0];
+      const double* __restrict eta_v = (*eta->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityLiquid(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDMolarDensityLiquid(h_v[i], eta_v[i], nl_v[i], ul_v[i], ni_v[i], ui_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == ul_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict h_v = (*h->ViewComponent(*comp, false))[0];
+      const double* __restrict eta_v = (*eta->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyLiquid(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDInternalEnergyLiquid(h_v[i], eta_v[i], nl_v[i], ul_v[i], ni_v[i], ui_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == ni_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict h_v = (*h->ViewComponent(*comp, false))[0];
+      const double* __restrict eta_v = (*eta->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDMolarDensityIce(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDMolarDensityIce(h_v[i], eta_v[i], nl_v[i], ul_v[i], ni_v[i], ui_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == ui_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict h_v = (*h->ViewComponent(*comp, false))[0];
+      const double* __restrict eta_v = (*eta->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDInternalEnergyIce(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDInternalEnergyIce(h_v[i], eta_v[i], nl_v[i], ul_v[i], ni_v[i], ui_v[i], cv_v[i]);
       }
     }
 
   } else if (wrt_key == cv_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& h_v = *h->ViewComponent(*comp, false);
-      const Epetra_MultiVector& eta_v = *eta->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ul_v = *ul->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ui_v = *ui->ViewComponent(*comp, false);
-      const Epetra_MultiVector& cv_v = *cv->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict h_v = (*h->ViewComponent(*comp, false))[0];
+      const double* __restrict eta_v = (*eta->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict ul_v = (*ul->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict ui_v = (*ui->ViewComponent(*comp, false))[0];
+      const double* __restrict cv_v = (*cv->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEnergyDCellVolume(h_v[0][i], eta_v[0][i], nl_v[0][i], ul_v[0][i], ni_v[0][i], ui_v[0][i], cv_v[0][i]);
+        result_v[i] = model_->DEnergyDCellVolume(h_v[i], eta_v[i], nl_v[i], ul_v[i], ni_v[i], ui_v[i], cv_v[i]);
       }
     }
 
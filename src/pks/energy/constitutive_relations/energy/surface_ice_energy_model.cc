@@ -30,55 +30,6 @@ SurfaceIceEnergyModel::InitializeFromPlist_(Teuchos::ParameterList& plist)
 }
 
 
-// main method
-double
-SurfaceIceEnergyModel::Energy(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
-{
-  return cv*h*(eta*nl*ul + ni*ui*(-eta + 1));
-}
-
-double
-SurfaceIceEnergyModel::DEnergyDPondedDepth(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
-{
-  return cv*(eta*nl*ul + ni*ui*(-eta + 1));
-}
-
-double
-SurfaceIceEnergyModel::DEnergyDUnfrozenFraction(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
-{
-  return cv*h*(-ni*ui + nl*ul);
-}
-
-double
-SurfaceIceEnergyModel::DEnergyDMolarDensityLiquid(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
-{
-  return cv*eta*h*ul;
-}
-
-double
-SurfaceIceEnergyModel::DEnergyDInternalEnergyLiquid(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
-{
-  return cv*eta*h*nl;
-}
-
-double
-SurfaceIceEnergyModel::DEnergyDMolarDensityIce(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
-{
-  return cv*h*ui*(-eta + 1);
-}
-
-double
-SurfaceIceEnergyModel::DEnergyDInternalEnergyIce(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
-{
-  return cv*h*ni*(-eta + 1);
-}
-
-double
-SurfaceIceEnergyModel::DEnergyDCellVolume(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
-{
-  return h*(eta*nl*ul + ni*ui*(-eta + 1));
-}
-
 } //namespace
 } //namespace
 } //namespace
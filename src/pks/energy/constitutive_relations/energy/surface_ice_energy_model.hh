@@ -10,6 +10,9 @@ Energy evaulator for ice+liquid surface water.
 #ifndef AMANZI_ENERGY_SURFACE_ICE_ENERGY_MODEL_HH_
 #define AMANZI_ENERGY_SURFACE_ICE_ENERGY_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace Energy {
 namespace Relations {
@@ -39,6 +42,58 @@ class SurfaceIceEnergyModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+SurfaceIceEnergyModel::Energy(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
+{
+  return cv*h*(eta*nl*ul + ni*ui*(-eta + 1));
+}
+
+inline double
+SurfaceIceEnergyModel::DEnergyDPondedDepth(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
+{
+  return cv*(eta*nl*ul + ni*ui*(-eta + 1));
+}
+
+inline double
+SurfaceIceEnergyModel::DEnergyDUnfrozenFraction(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
+{
+  return cv*h*(-ni*ui + nl*ul);
+}
+
+inline double
+SurfaceIceEnergyModel::DEnergyDMolarDensityLiquid(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
+{
+  return cv*eta*h*ul;
+}
+
+inline double
+SurfaceIceEnergyModel::DEnergyDInternalEnergyLiquid(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
+{
+  return cv*eta*h*nl;
+}
+
+inline double
+SurfaceIceEnergyModel::DEnergyDMolarDensityIce(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
+{
+  return cv*h*ui*(-eta + 1);
+}
+
+inline double
+SurfaceIceEnergyModel::DEnergyDInternalEnergyIce(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
+{
+  return cv*h*ni*(-eta + 1);
+}
+
+inline double
+SurfaceIceEnergyModel::DEnergyDCellVolume(double h, double eta, double nl, double ul, double ni, double ui, double cv) const
+{
+  return h*(eta*nl*ul + ni*ui*(-eta + 1));
+}
+
 } //namespace
 } //namespace
 } //namespace
@@ -10,6 +10,9 @@ Energy for a three-phase, gas+liquid+ice evaluator.
 #ifndef AMANZI_ENERGY_THREE_PHASE_ENERGY_MODEL_HH_
 #define AMANZI_ENERGY_THREE_PHASE_ENERGY_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace Energy {
 namespace Relations {
@@ -46,6 +49,100 @@ class ThreePhaseEnergyModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+ThreePhaseEnergyModel::Energy(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*(phi*(ng*sg*ug + ni*si*ui + nl*sl*ul) + rho_r*ur*(-phi0 + 1));
+}
+
+inline double
+ThreePhaseEnergyModel::DEnergyDPorosity(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*(ng*sg*ug + ni*si*ui + nl*sl*ul);
+}
+
+inline double
+ThreePhaseEnergyModel::DEnergyDBasePorosity(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return -cv*rho_r*ur;
+}
+
+inline double
+ThreePhaseEnergyModel::DEnergyDSaturationLiquid(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*nl*phi*ul;
+}
+
+inline double
+ThreePhaseEnergyModel::DEnergyDMolarDensityLiquid(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*phi*sl*ul;
+}
+
+inline double
+ThreePhaseEnergyModel::DEnergyDInternalEnergyLiquid(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*nl*phi*sl;
+}
+
+inline double
+ThreePhaseEnergyModel::DEnergyDSaturationIce(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*ni*phi*ui;
+}
+
+inline double
+ThreePhaseEnergyModel::DEnergyDMolarDensityIce(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*phi*si*ui;
+}
+
+inline double
+ThreePhaseEnergyModel::DEnergyDInternalEnergyIce(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*ni*phi*si;
+}
+
+inline double
+ThreePhaseEnergyModel::DEnergyDSaturationGas(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*ng*phi*ug;
+}
+
+inline double
+ThreePhaseEnergyModel::DEnergyDMolarDensityGas(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*phi*sg*ug;
+}
+
+inline double
+ThreePhaseEnergyModel::DEnergyDInternalEnergyGas(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*ng*phi*sg;
+}
+
+inline double
+ThreePhaseEnergyModel::DEnergyDDensityRock(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*ur*(-phi0 + 1);
+}
+
+inline double
+ThreePhaseEnergyModel::DEnergyDInternalEnergyRock(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return cv*rho_r*(-phi0 + 1);
+}
+
+inline double
+ThreePhaseEnergyModel::DEnergyDCellVolume(double phi, double phi0, double sl, double nl, double ul, double si, double ni, double ui, double sg, double ng, double ug, double rho_r, double ur, double cv) const
+{
+  return phi*(ng*sg*ug + ni*si*ui + nl*sl*ul) + rho_r*ur*(-phi0 + 1);
+}
+
 } //namespace
 } //namespace
 } //namespace
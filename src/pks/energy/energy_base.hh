@@ -161,6 +161,7 @@ Solves an advection-diffusion equation for energy:
 //#include "PK_PhysicalBDF_ATS.hh"
 #include "pk_physical_bdf_default.hh"
 #include "upwinding.hh"
+#include "boundary_face_plan.hh"
 
 namespace Amanzi {
 
@@ -269,6 +270,7 @@ public:
   Teuchos::RCP<Functions::BoundaryFunction> bc_temperature_;
   Teuchos::RCP<Functions::BoundaryFunction> bc_diff_flux_;
   Teuchos::RCP<Functions::BoundaryFunction> bc_flux_;
+  Teuchos::RCP<BoundaryFacePlan> bc_plan_;
 
   Teuchos::RCP<Operators::BCs> bc_adv_;
 
@@ -285,6 +287,9 @@ public:
   Teuchos::RCP<Operators::PDE_Accumulation> preconditioner_acc_;
   Teuchos::RCP<Operators::PDE_AdvectionUpwind> preconditioner_adv_;
 
+  // upwind cells for the matrix-free advection residual
+  std::vector<int> adv_upwind_cell_, adv_downwind_cell_;
+
   // flags and control
   bool modify_predictor_with_consistent_faces_;
   bool modify_predictor_for_freezing_;
@@ -12,6 +12,8 @@ de/dt + q dot grad h = div Ke grad T + S?
 ------------------------------------------------------------------------- */
 
 #include "advection.hh"
+#include "CompositeVectorSpace.hh"
+#include "face_cell_adjacency.hh"
 #include "FieldEvaluator.hh"
 #include "energy_base.hh"
 #include "Op.hh"
@@ -66,12 +68,28 @@ void EnergyBase::AddAdvection_(const Teuchos::Ptr<State>& S,
   Teuchos::RCP<const CompositeVector> enth = S->GetFieldData(enthalpy_key_);
   db_->WriteVectors({" adv flux", " enthalpy"}, {flux.ptr(), enth.ptr()}, true);
 
-  matrix_adv_->global_operator()->Init();
-  matrix_adv_->Setup(*flux);
-  matrix_adv_->SetBCs(bc_adv_, bc_adv_);
-  matrix_adv_->UpdateMatrices(flux.ptr());
-  matrix_adv_->ApplyBCs(false, true, false);
-  matrix_adv_->global_operator()->ComputeNegativeResidual(*enth, *g, false);
+  // Matrix-free first order upwind residual, matching PDE_AdvectionUpwind
+  // with Dirichlet BCs applied on inflow: each owned face contributes
+  // |q| h_upwind out of the upwind cell and into the downwind cell.  The
+  // assembled operator is only needed for the preconditioner.
+  const Operators::FaceCellAdjacency& adj = Operators::GetFaceCellAdjacency(mesh_);
+  const Epetra_MultiVector& flux_f = *flux->ViewComponent("face", false);
+  int nfaces_owned = flux_f.MyLength();
+  adj.IdentifyUpwindCells(flux_f, nfaces_owned, adv_upwind_cell_, adv_downwind_cell_);
+
+  // only cells are needed, whatever the components of enthalpy
+  CompositeVectorSpace adv_space;
+  adv_space.SetMesh(mesh_)->SetGhosted()->SetComponent("cell", AmanziMesh::CELL, 1);
+  Teuchos::RCP<CompositeVector> adv_res = workspace_.Get("advection residual", adv_space);
+  adv_res->PutScalarMasterAndGhosted(0.);
+
+  enth->ScatterMasterToGhosted("cell");
+  Operators::AddUpwindAdvectionResidual(adv_upwind_cell_, adv_downwind_cell_, flux_f,
+          *enth->ViewComponent("cell", true), bc_adv_->bc_model(), bc_adv_->bc_value(),
+          *adv_res->ViewComponent("cell", true));
+  adv_res->GatherGhostedToMaster("cell");
+
+  g->ViewComponent("cell", false)->Update(1., *adv_res->ViewComponent("cell", false), 1.);
 }
 
 // -------------------------------------------------------------
@@ -109,6 +109,7 @@ void EnergyBase::SetupEnergy_(const Teuchos::Ptr<State>& S)
   bc_temperature_ = bc_factory.CreateTemperature();
   bc_diff_flux_ = bc_factory.CreateDiffusiveFlux();
   bc_flux_ = bc_factory.CreateTotalFlux();
+  bc_plan_ = Teuchos::rcp(new BoundaryFacePlan(mesh_));
 
   bc_adv_ = Teuchos::rcp(new Operators::BCs(mesh_, AmanziMesh::FACE, WhetStone::DOF_Type::SCALAR));
 
@@ -538,18 +539,12 @@ void EnergyBase::UpdateBoundaryConditions_(
   }
 
   // mark all remaining boundary conditions as zero diffusive flux conditions
-  AmanziMesh::Entity_ID_List cells;
-  int nfaces_owned = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
-  for (int f = 0; f < nfaces_owned; f++) {
+  for (const auto& rec : bc_plan_->OwnedRecords()) {
+    int f = rec.f;
     if (markers[f] == Operators::OPERATOR_BC_NONE) {
-      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      int ncells = cells.size();
-
-      if (ncells == 1) {
-        markers[f] = Operators::OPERATOR_BC_NEUMANN;
-        values[f] = 0.0;
-        adv_markers[f] = Operators::OPERATOR_BC_DIRICHLET;
-      }
+      markers[f] = Operators::OPERATOR_BC_NEUMANN;
+      values[f] = 0.0;
+      adv_markers[f] = Operators::OPERATOR_BC_DIRICHLET;
     }
   }
 
@@ -796,7 +791,7 @@ EnergyBase::ModifyCorrection(double h, Teuchos::RCP<const TreeVector> res,
       if (bc_markers()[f] == Operators::OPERATOR_BC_NEUMANN &&
           bc_adv_->bc_model()[f] == Operators::OPERATOR_BC_DIRICHLET) {
         // diffusive flux BC
-        AmanziMesh::Entity_ID c = getFaceOnBoundaryInternalCell(*mesh_, f);
+        AmanziMesh::Entity_ID c = bc_plan_->Record(f).c;
         const auto& Acc = matrix_diff_->local_op()->matrices_shadow[f];
         double T_bf_val = (Acc(0,0)*(T_c[0][c] - dT_c[0][c]) - bc_values()[f]*mesh_->face_area(f)) / Acc(0,0);
         dT_bf[0][bf] = T_bf[0][bf] - T_bf_val;
@@ -7,6 +7,8 @@ License: see $ATS_DIR/COPYRIGHT
 Author: Ethan Coon
 ------------------------------------------------------------------------- */
 
+#include <algorithm>
+
 #include "boost/math/special_functions/fpclassify.hpp"
 #include "boost/test/floating_point_comparison.hpp"
 
@@ -14,6 +16,7 @@ Author: Ethan Coon
 #include "BoundaryFunction.hh"
 #include "FieldEvaluator.hh"
 #include "energy_base.hh"
+#include "face_cell_adjacency.hh"
 #include "Op.hh"
 
 namespace Amanzi {
@@ -45,12 +48,14 @@ void EnergyBase::FunctionalResidual(double t_old, double t_new, Teuchos::RCP<Tre
                << " t1 = " << t_new << " h = " << h << std::endl;
 
   // dump u_old, u_new
-  db_->WriteCellInfo(true);
-  std::vector<std::string> vnames;
-  vnames.push_back("T_old"); vnames.push_back("T_new");
-  std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
-  vecs.push_back(S_inter_->GetFieldData(key_).ptr()); vecs.push_back(u.ptr());
-  db_->WriteVectors(vnames, vecs, true);
+  if (db_gate_->Collect()) {
+    db_->WriteCellInfo(true);
+    std::vector<std::string> vnames;
+    vnames.push_back("T_old"); vnames.push_back("T_new");
+    std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
+    vecs.push_back(S_inter_->GetFieldData(key_).ptr()); vecs.push_back(u.ptr());
+    db_->WriteVectors(vnames, vecs, true);
+  }
 
   // vnames[0] = "sl"; vnames[1] = "si";
   // vecs[0] = S_next_->GetFieldData("saturation_liquid").ptr();
@@ -63,7 +68,7 @@ void EnergyBase::FunctionalResidual(double t_old, double t_new, Teuchos::RCP<Tre
   bc_diff_flux_->Compute(t_new);
   bc_flux_->Compute(t_new);
   UpdateBoundaryConditions_(S_next_.ptr());
-  db_->WriteBoundaryConditions(bc_markers(), bc_values());
+  if (db_gate_->Collect()) db_->WriteBoundaryConditions(bc_markers(), bc_values());
 
   // zero out residual
   Teuchos::RCP<CompositeVector> res = g->Data();
@@ -72,19 +77,24 @@ void EnergyBase::FunctionalResidual(double t_old, double t_new, Teuchos::RCP<Tre
   // diffusion term, implicit
   ApplyDiffusion_(S_next_.ptr(), res.ptr());
 #if DEBUG_FLAG
-  db_->WriteVector("K",S_next_->GetFieldData(conductivity_key_).ptr(),true);
-  db_->WriteVector("res (diff)", res.ptr(), true);
+  if (db_gate_->Collect()) {
+    db_->WriteVector("K",S_next_->GetFieldData(conductivity_key_).ptr(),true);
+    db_->WriteVector("res (diff)", res.ptr(), true);
+  }
 #endif
 
   // accumulation term
   AddAccumulation_(res.ptr());
 #if DEBUG_FLAG
-  vnames[0] = "e_old";
-  vnames[1] = "e_new";
-  vecs[0] = S_inter_->GetFieldData(conserved_key_).ptr();
-  vecs[1] = S_next_->GetFieldData(conserved_key_).ptr();
-  db_->WriteVectors(vnames, vecs, true);
-  db_->WriteVector("res (acc)", res.ptr());
+  if (db_gate_->Collect()) {
+    std::vector<std::string> vnames;
+    vnames.push_back("e_old"); vnames.push_back("e_new");
+    std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
+    vecs.push_back(S_inter_->GetFieldData(conserved_key_).ptr());
+    vecs.push_back(S_next_->GetFieldData(conserved_key_).ptr());
+    db_->WriteVectors(vnames, vecs, true);
+    db_->WriteVector("res (acc)", res.ptr());
+  }
 #endif
 
   // advection term
@@ -204,8 +214,9 @@ void EnergyBase::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> u
       ->ViewComponent("cell",false);
   unsigned int ncells = de_dT.MyLength();
 
-  CompositeVector acc(S_next_->GetFieldData(conserved_key_)->Map());
-  auto& acc_c = *acc.ViewComponent("cell", false);
+  Teuchos::RCP<CompositeVector> acc = workspace_.Get("accumulation",
+          S_next_->GetFieldData(conserved_key_)->Map());
+  auto& acc_c = *acc->ViewComponent("cell", false);
 
 #if DEBUG_FLAG
   db_->WriteVector("    de_dT", S_next_->GetFieldData(Keys::getDerivKey(conserved_key_, key_)).ptr());
@@ -236,7 +247,7 @@ void EnergyBase::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> u
       }
     }
   }
-  preconditioner_acc_->AddAccumulationTerm(acc, "cell");
+  preconditioner_acc_->AddAccumulationTerm(*acc, "cell");
 
   // -- update preconditioner with source term derivatives if needed
   AddSourcesToPrecon_(S_next_.ptr(), h);
@@ -286,56 +297,61 @@ double EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u,
 
   Teuchos::RCP<const CompositeVector> dvec = res->Data();
   double h = S_next_->time() - S_inter_->time();
+  double atol = atol_, fluxtol = fluxtol_;
+  double mass_atol = mass_atol_, soil_atol = soil_atol_;
+  bool locate = vo_->os_OK(Teuchos::VERB_MEDIUM);
 
-  Teuchos::RCP<const Comm_type> comm_p = mesh_->get_comm();
-  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
-    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
-  const MPI_Comm& comm = mpi_comm_p->Comm();
+  const double* cv_c = cv[0];
+  const double* wc_c = wc[0];
 
-  double enorm_val = 0.0;
+  std::vector<double> enorm_comps;
+  std::vector<int> enorm_locs;
   for (CompositeVector::name_iterator comp=dvec->begin();
        comp!=dvec->end(); ++comp) {
     double enorm_comp = 0.0;
     int enorm_loc = -1;
     const Epetra_MultiVector& dvec_v = *dvec->ViewComponent(*comp, false);
+    const double* dvec_e = dvec_v[0];
 
     if (*comp == std::string("cell")) {
       // error done in two parts, relative to mass but absolute in
       // energy since it doesn't make much sense to be relative to
       // energy
       int ncells = dvec->size(*comp,false);
-      for (unsigned int c=0; c!=ncells; ++c) {
-        double mass = std::max(mass_atol_, wc[0][c] / cv[0][c]);
-        double energy = mass * atol_ + soil_atol_;
-        double enorm_c = std::abs(h * dvec_v[0][c]) / (energy*cv[0][c]);
-
-        if (enorm_c > enorm_comp) {
-          enorm_comp = enorm_c;
-          enorm_loc = c;
-        }
+      enorm_work_.resize(ncells);
+      double* enorm_e = enorm_work_.data();
+
+#ifdef _OPENMP
+#pragma omp simd reduction(max:enorm_comp)
+#endif
+      for (int c=0; c<ncells; ++c) {
+        double mass = std::max(mass_atol, wc_c[c] / cv_c[c]);
+        double energy = mass * atol + soil_atol;
+        enorm_e[c] = std::abs(h * dvec_e[c]) / (energy*cv_c[c]);
+        enorm_comp = enorm_e[c] > enorm_comp ? enorm_e[c] : enorm_comp;
       }
 
     } else if (*comp == std::string("face")) {
       // error in flux -- relative to cell's extensive conserved quantity
       int nfaces = dvec->size(*comp, false);
+      enorm_work_.resize(nfaces);
+      double* enorm_e = enorm_work_.data();
+      const Operators::FaceCellAdjacency& adj = Operators::GetFaceCellAdjacency(mesh_);
 
-      for (unsigned int f=0; f!=nfaces; ++f) {
-        AmanziMesh::Entity_ID_List cells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
-        double cv_min = cells.size() == 1 ? cv[0][cells[0]]
-            : std::min(cv[0][cells[0]],cv[0][cells[1]]);
-        double mass_min = cells.size() == 1 ? wc[0][cells[0]]/cv[0][cells[0]]
-          : std::min(wc[0][cells[0]]/cv[0][cells[0]], wc[0][cells[1]]/cv[0][cells[1]]);
-        mass_min = std::max(mass_min, mass_atol_);
-
-        double energy = mass_min * atol_ + soil_atol_;
-        double enorm_f = fluxtol_ * h * std::abs(dvec_v[0][f])
+#ifdef _OPENMP
+#pragma omp simd reduction(max:enorm_comp)
+#endif
+      for (int f=0; f<nfaces; ++f) {
+        int c0 = adj.owned_cell(f,0);
+        int c1 = adj.owned_cell(f,1);
+        double cv_min = std::min(cv_c[c0], cv_c[c1]);
+        double mass_min = std::min(wc_c[c0]/cv_c[c0], wc_c[c1]/cv_c[c1]);
+        mass_min = std::max(mass_min, mass_atol);
+
+        double energy = mass_min * atol + soil_atol;
+        enorm_e[f] = fluxtol * h * std::abs(dvec_e[f])
           / (energy * cv_min);
-
-        if (enorm_f > enorm_comp) {
-          enorm_comp = enorm_f;
-          enorm_loc = f;
-        }
+        enorm_comp = enorm_e[f] > enorm_comp ? enorm_e[f] : enorm_comp;
       }
 
     } else {
@@ -345,32 +361,16 @@ double EnergyBase::ErrorNorm(Teuchos::RCP<const TreeVector> u,
       AMANZI_ASSERT(norm < 1.e-15);
     }
 
-
-    // Write out Inf norms too.
-    if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-      double infnorm(0.);
-      dvec_v.NormInf(&infnorm);
-
-      ENorm_t err;
-      ENorm_t l_err;
-      l_err.value = enorm_comp;
-      l_err.gid = dvec_v.Map().GID(enorm_loc);
-
-      int ierr;
-      ierr = MPI_Allreduce(&l_err, &err, 1, MPI_DOUBLE_INT, MPI_MAXLOC, comm);
-      AMANZI_ASSERT(!ierr);
-      *vo_->os() << "  ENorm (" << *comp << ") = " << err.value << "[" << err.gid << "] (" << infnorm << ")" << std::endl;
+    // the location is only needed to write it out
+    if (locate && enorm_comp > 0.) {
+      enorm_loc = std::find(enorm_work_.begin(), enorm_work_.end(), enorm_comp)
+          - enorm_work_.begin();
     }
-
-    enorm_val = std::max(enorm_val, enorm_comp);
+    enorm_comps.push_back(enorm_comp);
+    enorm_locs.push_back(enorm_loc);
   }
 
-  double enorm_val_l = enorm_val;
-
-  int ierr;
-  ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, comm);
-  AMANZI_ASSERT(!ierr);
-  return enorm_val;
+  return ReduceErrorNorms_(*dvec, enorm_comps, enorm_locs);
 };
 
 
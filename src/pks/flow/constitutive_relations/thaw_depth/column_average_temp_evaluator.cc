@@ -6,6 +6,7 @@
   Authors: Ahmad Jan (jana@ornl.gov)
 */
 
+#include "ColumnTopology.hh"
 #include "column_average_temp_evaluator.hh"
 
 namespace Amanzi {
@@ -46,37 +47,21 @@ ColumnAverageTempEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   // search through the column and find the deepest unfrozen cell
 
   std::string domain_ss = Keys::getDomain(temp_key_);
-  const auto& top_z_centroid = S->GetMesh(domain_ss)->face_centroid(0);
-  AmanziGeometry::Point z_centroid(top_z_centroid);
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh = S->GetMesh(domain_ss);
+  Relations::ColumnTopology& col = Relations::GetColumnTopology(mesh, true);
+  if (depth_ > 0.0 && S->IsDeformableMesh(domain_ss)) col.UpdateGeometry(*mesh);
 
   const auto& temp_c = *S->GetFieldData(temp_key_)->ViewComponent("cell", false);
-  
-  int col_cells = temp_c.MyLength();
-  double temp_sum = 0;
-  int count = 0 ;
-  
-  AMANZI_ASSERT (ncells_depth_ <= col_cells);
-
-  for (int i=0; i!=col_cells; ++i) {
-    if (depth_ > 0.0) {
-      z_centroid = S->GetMesh(domain_ss)->face_centroid(i+1);
-      double z_depth = top_z_centroid[2] - z_centroid[2];
-      if (z_depth <= depth_) {
-        temp_sum += temp_c[0][i];
-        count += 1;
-      }
-      else {
-        break;
-      }
-    }
-    else if (ncells_depth_ > 0 && i <= ncells_depth_) {
-      temp_sum += temp_c[0][i];
-      count += 1;
-    }
-  }
-  
-  res_c[0][0] = count >0 ? temp_sum/count : 0.0;
-
+  AMANZI_ASSERT (ncells_depth_ <= temp_c.MyLength());
+
+  // average over the cells above depth_, or else the top ncells_depth_+1 cells
+  Relations::ColumnWeightedAverage(col,
+          [&](int k) { return temp_c[0][col.cell(k)]; },
+          [&](int k) {
+            if (depth_ > 0.0) return col.depth_bottom(k) <= depth_ ? 1. : 0.;
+            return (ncells_depth_ > 0 && k <= ncells_depth_) ? 1. : 0.;
+          },
+          res_c[0]);
 }
   
 void
@@ -7,6 +7,7 @@
   Authors: Ahmad Jan (jana@ornl.gov)
 */
 
+#include "ColumnTopology.hh"
 #include "moisture_content_evaluator.hh"
 
 namespace Amanzi {
@@ -77,29 +78,25 @@ MoistureContentEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   const auto& cv_c = *S->GetFieldData(cv_key_)->ViewComponent("cell", false);
   const auto& sat_c = *S->GetFieldData(sat_key_)->ViewComponent("cell", false);
 
-  int col_cells = temp_c.MyLength();
-  double col_sum = 0;
-  double cv_sum = 0;
+  // average over unfrozen cells, weighted by volume unless volumetric
+  const Relations::ColumnTopology& col =
+      Relations::GetColumnTopology(S->GetMesh(domain_ss), true);
   if (!volumetric_wc_) {
-    for (int i=0; i!=col_cells; ++i) {
-      if (temp_c[0][i] >= trans_temp) {
-        col_sum += cv_c[0][i] * sat_c[0][i];
-        cv_sum += cv_c[0][i];
-      }
-    }
+    Relations::ColumnWeightedAverage(col,
+            [&](int k) { return sat_c[0][col.cell(k)]; },
+            [&](int k) {
+              int i = col.cell(k);
+              return temp_c[0][i] >= trans_temp ? cv_c[0][i] : 0.;
+            },
+            res_c[0]);
   }
   else {
     const auto& por_c = *S->GetFieldData(por_key_)->ViewComponent("cell", false);
-    for (int i=0; i!=col_cells; ++i) {
-      if (temp_c[0][i] >= trans_temp) {
-        col_sum += por_c[0][i] * sat_c[0][i];
-        cv_sum += 1.0;
-      }
-    }
+    Relations::ColumnWeightedAverage(col,
+            [&](int k) { int i = col.cell(k); return por_c[0][i] * sat_c[0][i]; },
+            [&](int k) { return temp_c[0][col.cell(k)] >= trans_temp ? 1. : 0.; },
+            res_c[0]);
   }
-  
-  res_c[0][0] = cv_sum > 0.0 ? col_sum/cv_sum : 0;
- 
 }
   
 void
@@ -7,6 +7,7 @@
   Authors: Ahmad Jan (jana@ornl.gov)
 */
 
+#include "ColumnTopology.hh"
 #include "thaw_depth_evaluator.hh"
 
 namespace Amanzi {
@@ -53,21 +54,16 @@ ThawDepthEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   // search through the column and find the deepest unfrozen cell
 
   std::string domain_ss = Keys::getDomain(temp_key_);
-  const auto& top_z_centroid = S->GetMesh(domain_ss)->face_centroid(0);
-  AmanziGeometry::Point z_centroid(top_z_centroid);
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh = S->GetMesh(domain_ss);
+  Relations::ColumnTopology& col = Relations::GetColumnTopology(mesh, true);
+  if (S->IsDeformableMesh(domain_ss)) col.UpdateGeometry(*mesh);
 
   const auto& temp_c = *S->GetFieldData(temp_key_)
     ->ViewComponent("cell", false);
-    
-  int col_cells = temp_c.MyLength();
-  for (int i=0; i!=col_cells; ++i) {
-    if (temp_c[0][i] >= trans_temp) {
-      z_centroid = S->GetMesh(domain_ss)->face_centroid(i+1);
-    }
-  }
-  
-  res_c[0][0] = top_z_centroid[2] - z_centroid[2];
-  
+
+  Relations::ColumnLastCrossingDepth(col,
+          [&](int k) { return temp_c[0][col.cell(k)] >= trans_temp; },
+          0., res_c[0]);
 }
   
 void
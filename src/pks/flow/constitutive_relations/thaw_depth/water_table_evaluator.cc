@@ -7,6 +7,7 @@
   Authors: Ahmad Jan (jana@ornl.gov)
 */
 
+#include "ColumnTopology.hh"
 #include "water_table_evaluator.hh"
 
 namespace Amanzi {
@@ -57,28 +58,16 @@ WaterTableEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   // search through the column and find the deepest unfrozen cell
 
   std::string domain_ss = Keys::getDomain(temp_key_);
-  const auto& top_z_centroid = S->GetMesh(domain_ss)->face_centroid(0);
-  AmanziGeometry::Point z_centroid(top_z_centroid);
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh = S->GetMesh(domain_ss);
+  Relations::ColumnTopology& col = Relations::GetColumnTopology(mesh, true);
+  if (S->IsDeformableMesh(domain_ss)) col.UpdateGeometry(*mesh);
 
-  const auto& temp_c = *S->GetFieldData(temp_key_)->ViewComponent("cell", false);
   const auto& sat_c = *S->GetFieldData(sat_key_)->ViewComponent("cell", false);
 
-  int col_cells = temp_c.MyLength();
-  bool water_flag = false;
-
-  for (int i=0; i!=col_cells; ++i) {
-    if (sat_c[0][i] == 1.0) {
-      z_centroid = S->GetMesh(domain_ss)->face_centroid(i);
-      water_flag = true;
-      break;
-    }
-  }
-  
-  if (water_flag)
-    res_c[0][0] = top_z_centroid[2] - z_centroid[2];
-  else
-    res_c[0][0] = -100; // no water table
- 
+  // -100 indicates no water table
+  Relations::ColumnFirstCrossingDepth(col,
+          [&](int k) { return sat_c[0][col.cell(k)] == 1.0; },
+          -100., res_c[0]);
 }
   
 void
@@ -102,18 +102,18 @@ Teuchos::RCP<const CompositeVector> T = S->GetFieldData(T_key_);
 
   for (CompositeVector::name_iterator comp=result->begin();
        comp!=result->end(); ++comp) {
-    const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-    const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-    const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-    const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-    const Epetra_MultiVector& rhos_v = *rhos->ViewComponent(*comp, false);
-    const Epetra_MultiVector& T_v = *T->ViewComponent(*comp, false);
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+    const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+    const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+    const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+    const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+    const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+    const double* __restrict rhos_v = (*rhos->ViewComponent(*comp, false))[0];
+    const double* __restrict T_v = (*T->ViewComponent(*comp, false))[0];
+    double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
     int ncomp = result->size(*comp, false);
     for (int i=0; i!=ncomp; ++i) {
-      result_v[0][i] = model_->DEnergyDTCoef(phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
+      result_v[i] = model_->DEnergyDTCoef(phi_v[i], sl_v[i], nl_v[i], si_v[i], ni_v[i], rhos_v[i], T_v[i]);
     }
   }
 }
@@ -134,126 +134,126 @@ Teuchos::RCP<const CompositeVector> T = S->GetFieldData(T_key_);
   if (wrt_key == phi_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rhos_v = *rhos->ViewComponent(*comp, false);
-      const Epetra_MultiVector& T_v = *T->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict rhos_v = (*rhos->ViewComponent(*comp, false))[0];
+      const double* __restrict T_v = (*T->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DDEnergyDTCoefDPorosity(phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
+        result_v[i] = model_->DDEnergyDTCoefDPorosity(phi_v[i], sl_v[i], nl_v[i], si_v[i], ni_v[i], rhos_v[i], T_v[i]);
       }
     }
 
   } else if (wrt_key == sl_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rhos_v = *rhos->ViewComponent(*comp, false);
-      const Epetra_MultiVector& T_v = *T->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict rhos_v = (*rhos->ViewComponent(*comp, false))[0];
+      const double* __restrict T_v = (*T->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DDEnergyDTCoefDSaturationLiquid(phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
+        result_v[i] = model_->DDEnergyDTCoefDSaturationLiquid(phi_v[i], sl_v[i], nl_v[i], si_v[i], ni_v[i], rhos_v[i], T_v[i]);
       }
     }
 
   } else if (wrt_key == nl_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rhos_v = *rhos->ViewComponent(*comp, false);
-      const Epetra_MultiVector& T_v = *T->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict rhos_v = (*rhos->ViewComponent(*comp, false))[0];
+      const double* __restrict T_v = (*T->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DDEnergyDTCoefDMolarDensityLiquid(phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
+        result_v[i] = model_->DDEnergyDTCoefDMolarDensityLiquid(phi_v[i], sl_v[i], nl_v[i], si_v[i], ni_v[i], rhos_v[i], T_v[i]);
       }
     }
 
   } else if (wrt_key == si_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rhos_v = *rhos->ViewComponent(*comp, false);
-      const Epetra_MultiVector& T_v = *T->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict rhos_v = (*rhos->ViewComponent(*comp, false))[0];
+      const double* __restrict T_v = (*T->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DDEnergyDTCoefDSaturationIce(phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
+        result_v[i] = model_->DDEnergyDTCoefDSaturationIce(phi_v[i], sl_v[i], nl_v[i], si_v[i], ni_v[i], rhos_v[i], T_v[i]);
       }
     }
 
   } else if (wrt_key == ni_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rhos_v = *rhos->ViewComponent(*comp, false);
-      const Epetra_MultiVector& T_v = *T->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict rhos_v = (*rhos->ViewComponent(*comp, false))[0];
+      const double* __restrict T_v = (*T->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DDEnergyDTCoefDMolarDensityIce(phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
+        result_v[i] = model_->DDEnergyDTCoefDMolarDensityIce(phi_v[i], sl_v[i], nl_v[i], si_v[i], ni_v[i], rhos_v[i], T_v[i]);
       }
     }
 
   } else if (wrt_key == rhos_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rhos_v = *rhos->ViewComponent(*comp, false);
-      const Epetra_MultiVector& T_v = *T->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict rhos_v = (*rhos->ViewComponent(*comp, false))[0];
+      const double* __restrict T_v = (*T->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DDEnergyDTCoefDDensityRock(phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
+        result_v[i] = model_->DDEnergyDTCoefDDensityRock(phi_v[i], sl_v[i], nl_v[i], si_v[i], ni_v[i], rhos_v[i], T_v[i]);
       }
     }
 
   } else if (wrt_key == T_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& phi_v = *phi->ViewComponent(*comp, false);
-      const Epetra_MultiVector& sl_v = *sl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& nl_v = *nl->ViewComponent(*comp, false);
-      const Epetra_MultiVector& si_v = *si->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ni_v = *ni->ViewComponent(*comp, false);
-      const Epetra_MultiVector& rhos_v = *rhos->ViewComponent(*comp, false);
-      const Epetra_MultiVector& T_v = *T->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict phi_v = (*phi->ViewComponent(*comp, false))[0];
+      const double* __restrict sl_v = (*sl->ViewComponent(*comp, false))[0];
+      const double* __restrict nl_v = (*nl->ViewComponent(*comp, false))[0];
+      const double* __restrict si_v = (*si->ViewComponent(*comp, false))[0];
+      const double* __restrict ni_v = (*ni->ViewComponent(*comp, false))[0];
+      const double* __restrict rhos_v = (*rhos->ViewComponent(*comp, false))[0];
+      const double* __restrict T_v = (*T->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DDEnergyDTCoefDTemperature(phi_v[0][i], sl_v[0][i], nl_v[0][i], si_v[0][i], ni_v[0][i], rhos_v[0][i], T_v[0][i]);
+        result_v[i] = model_->DDEnergyDTCoefDTemperature(phi_v[i], sl_v[i], nl_v[i], si_v[i], ni_v[i], rhos_v[i], T_v[i]);
       }
     }
 
@@ -10,6 +10,9 @@ Interfrost water content portion sl.
 #ifndef AMANZI_FLOW_INTERFROST_DENERGY_DTEMPERATURE_MODEL_HH_
 #define AMANZI_FLOW_INTERFROST_DENERGY_DTEMPERATURE_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace Flow {
 namespace Relations {
@@ -39,6 +42,78 @@ class InterfrostDenergyDtemperatureModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+InterfrostDenergyDtemperatureModel::DEnergyDTCoef(double phi, double sl, double nl, double si, double ni, double rhos, double T) const
+{
+  return 0.0060171102*ni*phi*((T >= 273.15) ? (
+   0.0
+)
+: (
+   -0.95*(2*T - 546.3)*exp(-pow(T - 273.15, 2)/pow(W_, 2))/pow(W_, 2)
+) ) + 1.0e-6*phi*(37.111518*ni*si + 75.3399846*nl*sl) + 0.000835*rhos*(-phi + 1);
+}
+
+inline double
+InterfrostDenergyDtemperatureModel::DDEnergyDTCoefDPorosity(double phi, double sl, double nl, double si, double ni, double rhos, double T) const
+{
+  return 3.7111518e-5*ni*si + 0.0060171102*ni*((T >= 273.15) ? (
+   0.0
+)
+: (
+   -0.95*(2*T - 546.3)*exp(-pow(T - 273.15, 2)/pow(W_, 2))/pow(W_, 2)
+) ) + 7.53399846e-5*nl*sl - 0.000835*rhos;
+}
+
+inline double
+InterfrostDenergyDtemperatureModel::DDEnergyDTCoefDSaturationLiquid(double phi, double sl, double nl, double si, double ni, double rhos, double T) const
+{
+  return 7.53399846e-5*nl*phi;
+}
+
+inline double
+InterfrostDenergyDtemperatureModel::DDEnergyDTCoefDMolarDensityLiquid(double phi, double sl, double nl, double si, double ni, double rhos, double T) const
+{
+  return 7.53399846e-5*phi*sl;
+}
+
+inline double
+InterfrostDenergyDtemperatureModel::DDEnergyDTCoefDSaturationIce(double phi, double sl, double nl, double si, double ni, double rhos, double T) const
+{
+  return 3.7111518e-5*ni*phi;
+}
+
+inline double
+InterfrostDenergyDtemperatureModel::DDEnergyDTCoefDMolarDensityIce(double phi, double sl, double nl, double si, double ni, double rhos, double T) const
+{
+  return 3.7111518e-5*phi*si + 0.0060171102*phi*((T >= 273.15) ? (
+   0.0
+)
+: (
+   -0.95*(2*T - 546.3)*exp(-pow(T - 273.15, 2)/pow(W_, 2))/pow(W_, 2)
+) );
+}
+
+inline double
+InterfrostDenergyDtemperatureModel::DDEnergyDTCoefDDensityRock(double phi, double sl, double nl, double si, double ni, double rhos, double T) const
+{
+  return -0.000835*phi + 0.000835;
+}
+
+inline double
+InterfrostDenergyDtemperatureModel::DDEnergyDTCoefDTemperature(double phi, double sl, double nl, double si, double ni, double rhos, double T) const
+{
+  return 0.0060171102*ni*phi*((T >= 273.15) ? (
+   0
+)
+: (
+   -1.9*exp(-pow(T - 273.15, 2)/pow(W_, 2))/pow(W_, 2) + 0.95*pow(2*T - 546.3, 2)*exp(-pow(T - 273.15, 2)/pow(W_, 2))/pow(W_, 4)
+) );
+}
+
 } //namespace
 } //namespace
 } //namespace
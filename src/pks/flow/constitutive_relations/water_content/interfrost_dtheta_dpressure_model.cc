@@ -30,31 +30,6 @@ InterfrostDthetaDpressureModel::InitializeFromPlist_(Teuchos::ParameterList& pli
 }
 
 
-// main method
-double
-InterfrostDthetaDpressureModel::DThetaDpCoef(double nl, double sl, double phi) const
-{
-  return beta_*nl*phi*sl;
-}
-
-double
-InterfrostDthetaDpressureModel::DDThetaDpCoefDMolarDensityLiquid(double nl, double sl, double phi) const
-{
-  return beta_*phi*sl;
-}
-
-double
-InterfrostDthetaDpressureModel::DDThetaDpCoefDSaturationLiquid(double nl, double sl, double phi) const
-{
-  return beta_*nl*phi;
-}
-
-double
-InterfrostDthetaDpressureModel::DDThetaDpCoefDPorosity(double nl, double sl, double phi) const
-{
-  return beta_*nl*sl;
-}
-
 } //namespace
 } //namespace
 } //namespace
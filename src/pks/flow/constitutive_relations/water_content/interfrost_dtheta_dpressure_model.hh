@@ -10,6 +10,9 @@ Interfrost water content portion sl.
 #ifndef AMANZI_FLOW_INTERFROST_DTHETA_DPRESSURE_MODEL_HH_
 #define AMANZI_FLOW_INTERFROST_DTHETA_DPRESSURE_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace Flow {
 namespace Relations {
@@ -35,6 +38,34 @@ class InterfrostDthetaDpressureModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+InterfrostDthetaDpressureModel::DThetaDpCoef(double nl, double sl, double phi) const
+{
+  return beta_*nl*phi*sl;
+}
+
+inline double
+InterfrostDthetaDpressureModel::DDThetaDpCoefDMolarDensityLiquid(double nl, double sl, double phi) const
+{
+  return beta_*phi*sl;
+}
+
+inline double
+InterfrostDthetaDpressureModel::DDThetaDpCoefDSaturationLiquid(double nl, double sl, double phi) const
+{
+  return beta_*nl*phi;
+}
+
+inline double
+InterfrostDthetaDpressureModel::DDThetaDpCoefDPorosity(double nl, double sl, double phi) const
+{
+  return beta_*nl*sl;
+}
+
 } //namespace
 } //namespace
 } //namespace
@@ -30,43 +30,6 @@ InterfrostSlWcModel::InitializeFromPlist_(Teuchos::ParameterList& plist)
 }
 
 
-// main method
-double
-InterfrostSlWcModel::WaterContent(double phi, double sl, double nl, double ni, double cv) const
-{
-  return cv*phi*sl*(-ni + nl);
-}
-
-double
-InterfrostSlWcModel::DWaterContentDPorosity(double phi, double sl, double nl, double ni, double cv) const
-{
-  return cv*sl*(-ni + nl);
-}
-
-double
-InterfrostSlWcModel::DWaterContentDSaturationLiquid(double phi, double sl, double nl, double ni, double cv) const
-{
-  return cv*phi*(-ni + nl);
-}
-
-double
-InterfrostSlWcModel::DWaterContentDMolarDensityLiquid(double phi, double sl, double nl, double ni, double cv) const
-{
-  return cv*phi*sl;
-}
-
-double
-InterfrostSlWcModel::DWaterContentDMolarDensityIce(double phi, double sl, double nl, double ni, double cv) const
-{
-  return -cv*phi*sl;
-}
-
-double
-InterfrostSlWcModel::DWaterContentDCellVolume(double phi, double sl, double nl, double ni, double cv) const
-{
-  return phi*sl*(-ni + nl);
-}
-
 } //namespace
 } //namespace
 } //namespace
@@ -10,6 +10,9 @@ Interfrost water content portion sl.
 #ifndef AMANZI_FLOW_INTERFROST_SL_WC_MODEL_HH_
 #define AMANZI_FLOW_INTERFROST_SL_WC_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace Flow {
 namespace Relations {
@@ -37,6 +40,46 @@ class InterfrostSlWcModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+InterfrostSlWcModel::WaterContent(double phi, double sl, double nl, double ni, double cv) const
+{
+  return cv*phi*sl*(-ni + nl);
+}
+
+inline double
+InterfrostSlWcModel::DWaterContentDPorosity(double phi, double sl, double nl, double ni, double cv) const
+{
+  return cv*sl*(-ni + nl);
+}
+
+inline double
+InterfrostSlWcModel::DWaterContentDSaturationLiquid(double phi, double sl, double nl, double ni, double cv) const
+{
+  return cv*phi*(-ni + nl);
+}
+
+inline double
+InterfrostSlWcModel::DWaterContentDMolarDensityLiquid(double phi, double sl, double nl, double ni, double cv) const
+{
+  return cv*phi*sl;
+}
+
+inline double
+InterfrostSlWcModel::DWaterContentDMolarDensityIce(double phi, double sl, double nl, double ni, double cv) const
+{
+  return -cv*phi*sl;
+}
+
+inline double
+InterfrostSlWcModel::DWaterContentDCellVolume(double phi, double sl, double nl, double ni, double cv) const
+{
+  return phi*sl*(-ni + nl);
+}
+
 } //namespace
 } //namespace
 } //namespace
@@ -10,6 +10,9 @@ Water content for a two-phase, liquid+water vapor evaluator.
 #ifndef AMANZI_FLOW_LIQUID_GAS_WATER_CONTENT_MODEL_HH_
 #define AMANZI_FLOW_LIQUID_GAS_WATER_CONTENT_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace Flow {
 namespace Relations {
@@ -39,6 +42,58 @@ class LiquidGasWaterContentModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+LiquidGasWaterContentModel::WaterContent(double phi, double sl, double nl, double sg, double ng, double omega, double cv) const
+{
+  return cv*phi*(ng*omega*sg + nl*sl);
+}
+
+inline double
+LiquidGasWaterContentModel::DWaterContentDPorosity(double phi, double sl, double nl, double sg, double ng, double omega, double cv) const
+{
+  return cv*(ng*omega*sg + nl*sl);
+}
+
+inline double
+LiquidGasWaterContentModel::DWaterContentDSaturationLiquid(double phi, double sl, double nl, double sg, double ng, double omega, double cv) const
+{
+  return cv*nl*phi;
+}
+
+inline double
+LiquidGasWaterContentModel::DWaterContentDMolarDensityLiquid(double phi, double sl, double nl, double sg, double ng, double omega, double cv) const
+{
+  return cv*phi*sl;
+}
+
+inline double
+LiquidGasWaterContentModel::DWaterContentDSaturationGas(double phi, double sl, double nl, double sg, double ng, double omega, double cv) const
+{
+  return cv*ng*omega*phi;
+}
+
+inline double
+LiquidGasWaterContentModel::DWaterContentDMolarDensityGas(double phi, double sl, double nl, double sg, double ng, double omega, double cv) const
+{
+  return cv*omega*phi*sg;
+}
+
+inline double
+LiquidGasWaterContentModel::DWaterContentDMolFracGas(double phi, double sl, double nl, double sg, double ng, double omega, double cv) const
+{
+  return cv*ng*phi*sg;
+}
+
+inline double
+LiquidGasWaterContentModel::DWaterContentDCellVolume(double phi, double sl, double nl, double sg, double ng, double omega, double cv) const
+{
+  return phi*(ng*omega*sg + nl*sl);
+}
+
 } //namespace
 } //namespace
 } //namespace
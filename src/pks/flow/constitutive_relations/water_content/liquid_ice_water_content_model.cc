@@ -30,49 +30,6 @@ LiquidIceWaterContentModel::InitializeFromPlist_(Teuchos::ParameterList& plist)
 }
 
 
-// main method
-double
-LiquidIceWaterContentModel::WaterContent(double phi, double sl, double nl, double si, double ni, double cv) const
-{
-  return cv*phi*(ni*si + nl*sl);
-}
-
-double
-LiquidIceWaterContentModel::DWaterContentDPorosity(double phi, double sl, double nl, double si, double ni, double cv) const
-{
-  return cv*(ni*si + nl*sl);
-}
-
-double
-LiquidIceWaterContentModel::DWaterContentDSaturationLiquid(double phi, double sl, double nl, double si, double ni, double cv) const
-{
-  return cv*nl*phi;
-}
-
-double
-LiquidIceWaterContentModel::DWaterContentDMolarDensityLiquid(double phi, double sl, double nl, double si, double ni, double cv) const
-{
-  return cv*phi*sl;
-}
-
-double
-LiquidIceWaterContentModel::DWaterContentDSaturationIce(double phi, double sl, double nl, double si, double ni, double cv) const
-{
-  return cv*ni*phi;
-}
-
-double
-LiquidIceWaterContentModel::DWaterContentDMolarDensityIce(double phi, double sl, double nl, double si, double ni, double cv) const
-{
-  return cv*phi*si;
-}
-
-double
-LiquidIceWaterContentModel::DWaterContentDCellVolume(double phi, double sl, double nl, double si, double ni, double cv) const
-{
-  return phi*(ni*si + nl*sl);
-}
-
 } //namespace
 } //namespace
 } //namespace
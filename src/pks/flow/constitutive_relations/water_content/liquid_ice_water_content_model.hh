@@ -10,6 +10,9 @@ Water content for a two-phase, liquid+ice evaluator.
 #ifndef AMANZI_FLOW_LIQUID_ICE_WATER_CONTENT_MODEL_HH_
 #define AMANZI_FLOW_LIQUID_ICE_WATER_CONTENT_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace Flow {
 namespace Relations {
@@ -38,6 +41,52 @@ class LiquidIceWaterContentModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+LiquidIceWaterContentModel::WaterContent(double phi, double sl, double nl, double si, double ni, double cv) const
+{
+  return cv*phi*(ni*si + nl*sl);
+}
+
+inline double
+LiquidIceWaterContentModel::DWaterContentDPorosity(double phi, double sl, double nl, double si, double ni, double cv) const
+{
+  return cv*(ni*si + nl*sl);
+}
+
+inline double
+LiquidIceWaterContentModel::DWaterContentDSaturationLiquid(double phi, double sl, double nl, double si, double ni, double cv) const
+{
+  return cv*nl*phi;
+}
+
+inline double
+LiquidIceWaterContentModel::DWaterContentDMolarDensityLiquid(double phi, double sl, double nl, double si, double ni, double cv) const
+{
+  return cv*phi*sl;
+}
+
+inline double
+LiquidIceWaterContentModel::DWaterContentDSaturationIce(double phi, double sl, double nl, double si, double ni, double cv) const
+{
+  return cv*ni*phi;
+}
+
+inline double
+LiquidIceWaterContentModel::DWaterContentDMolarDensityIce(double phi, double sl, double nl, double si, double ni, double cv) const
+{
+  return cv*phi*si;
+}
+
+inline double
+LiquidIceWaterContentModel::DWaterContentDCellVolume(double phi, double sl, double nl, double si, double ni, double cv) const
+{
+  return phi*(ni*si + nl*sl);
+}
+
 } //namespace
 } //namespace
 } //namespace
@@ -30,37 +30,6 @@ RichardsWaterContentModel::InitializeFromPlist_(Teuchos::ParameterList& plist)
 }
 
 
-// main method
-double
-RichardsWaterContentModel::WaterContent(double phi, double sl, double nl, double cv) const
-{
-  return cv*nl*phi*sl;
-}
-
-double
-RichardsWaterContentModel::DWaterContentDPorosity(double phi, double sl, double nl, double cv) const
-{
-  return cv*nl*sl;
-}
-
-double
-RichardsWaterContentModel::DWaterContentDSaturationLiquid(double phi, double sl, double nl, double cv) const
-{
-  return cv*nl*phi;
-}
-
-double
-RichardsWaterContentModel::DWaterContentDMolarDensityLiquid(double phi, double sl, double nl, double cv) const
-{
-  return cv*phi*sl;
-}
-
-double
-RichardsWaterContentModel::DWaterContentDCellVolume(double phi, double sl, double nl, double cv) const
-{
-  return nl*phi*sl;
-}
-
 } //namespace
 } //namespace
 } //namespace
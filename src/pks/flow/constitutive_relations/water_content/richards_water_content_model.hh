@@ -10,6 +10,9 @@ Richards water content evaluator: the standard form as a function of liquid satu
 #ifndef AMANZI_FLOW_RICHARDS_WATER_CONTENT_MODEL_HH_
 #define AMANZI_FLOW_RICHARDS_WATER_CONTENT_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace Flow {
 namespace Relations {
@@ -36,6 +39,40 @@ class RichardsWaterContentModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+RichardsWaterContentModel::WaterContent(double phi, double sl, double nl, double cv) const
+{
+  return cv*nl*phi*sl;
+}
+
+inline double
+RichardsWaterContentModel::DWaterContentDPorosity(double phi, double sl, double nl, double cv) const
+{
+  return cv*nl*sl;
+}
+
+inline double
+RichardsWaterContentModel::DWaterContentDSaturationLiquid(double phi, double sl, double nl, double cv) const
+{
+  return cv*nl*phi;
+}
+
+inline double
+RichardsWaterContentModel::DWaterContentDMolarDensityLiquid(double phi, double sl, double nl, double cv) const
+{
+  return cv*phi*sl;
+}
+
+inline double
+RichardsWaterContentModel::DWaterContentDCellVolume(double phi, double sl, double nl, double cv) const
+{
+  return nl*phi*sl;
+}
+
 } //namespace
 } //namespace
 } //namespace
@@ -30,67 +30,6 @@ ThreePhaseWaterContentModel::InitializeFromPlist_(Teuchos::ParameterList& plist)
 }
 
 
-// main method
-double
-ThreePhaseWaterContentModel::WaterContent(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
-{
-  return cv*phi*(ng*omega*sg + ni*si + nl*sl);
-}
-
-double
-ThreePhaseWaterContentModel::DWaterContentDPorosity(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
-{
-  return cv*(ng*omega*sg + ni*si + nl*sl);
-}
-
-double
-ThreePhaseWaterContentModel::DWaterContentDSaturationLiquid(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
-{
-  return cv*nl*phi;
-}
-
-double
-ThreePhaseWaterContentModel::DWaterContentDMolarDensityLiquid(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
-{
-  return cv*phi*sl;
-}
-
-double
-ThreePhaseWaterContentModel::DWaterContentDSaturationIce(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
-{
-  return cv*ni*phi;
-}
-
-double
-ThreePhaseWaterContentModel::DWaterContentDMolarDensityIce(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
-{
-  return cv*phi*si;
-}
-
-double
-ThreePhaseWaterContentModel::DWaterContentDSaturationGas(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
-{
-  return cv*ng*omega*phi;
-}
-
-double
-ThreePhaseWaterContentModel::DWaterContentDMolarDensityGas(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
-{
-  return cv*omega*phi*sg;
-}
-
-double
-ThreePhaseWaterContentModel::DWaterContentDMolFracGas(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
-{
-  return cv*ng*phi*sg;
-}
-
-double
-ThreePhaseWaterContentModel::DWaterContentDCellVolume(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
-{
-  return phi*(ng*omega*sg + ni*si + nl*sl);
-}
-
 } //namespace
 } //namespace
 } //namespace
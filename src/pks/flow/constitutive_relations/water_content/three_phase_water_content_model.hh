@@ -10,6 +10,9 @@ Water content for a three-phase, gas+liquid+ice evaluator.
 #ifndef AMANZI_FLOW_THREE_PHASE_WATER_CONTENT_MODEL_HH_
 #define AMANZI_FLOW_THREE_PHASE_WATER_CONTENT_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace Flow {
 namespace Relations {
@@ -41,6 +44,70 @@ class ThreePhaseWaterContentModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+ThreePhaseWaterContentModel::WaterContent(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
+{
+  return cv*phi*(ng*omega*sg + ni*si + nl*sl);
+}
+
+inline double
+ThreePhaseWaterContentModel::DWaterContentDPorosity(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
+{
+  return cv*(ng*omega*sg + ni*si + nl*sl);
+}
+
+inline double
+ThreePhaseWaterContentModel::DWaterContentDSaturationLiquid(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
+{
+  return cv*nl*phi;
+}
+
+inline double
+ThreePhaseWaterContentModel::DWaterContentDMolarDensityLiquid(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
+{
+  return cv*phi*sl;
+}
+
+inline double
+ThreePhaseWaterContentModel::DWaterContentDSaturationIce(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
+{
+  return cv*ni*phi;
+}
+
+inline double
+ThreePhaseWaterContentModel::DWaterContentDMolarDensityIce(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
+{
+  return cv*phi*si;
+}
+
+inline double
+ThreePhaseWaterContentModel::DWaterContentDSaturationGas(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
+{
+  return cv*ng*omega*phi;
+}
+
+inline double
+ThreePhaseWaterContentModel::DWaterContentDMolarDensityGas(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
+{
+  return cv*omega*phi*sg;
+}
+
+inline double
+ThreePhaseWaterContentModel::DWaterContentDMolFracGas(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
+{
+  return cv*ng*phi*sg;
+}
+
+inline double
+ThreePhaseWaterContentModel::DWaterContentDCellVolume(double phi, double sl, double nl, double si, double ni, double sg, double ng, double omega, double cv) const
+{
+  return phi*(ng*omega*sg + ni*si + nl*sl);
+}
+
 } //namespace
 } //namespace
 } //namespace
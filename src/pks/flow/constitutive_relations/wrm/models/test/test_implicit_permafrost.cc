@@ -1,4 +1,5 @@
 #include <iostream>
+#include <vector>
 #include "UnitTest++.h"
 
 #include "wrm_van_genuchten.hh"
@@ -164,3 +165,86 @@ TEST(implicitPermafrost) {
   // CHECK_CLOSE(sats[2], sats2[2], std::abs(sats[2])/1.e3 + 1.e-10);
 
 }
+
+
+// The Newton solver, scalar and batched, cold and warm started, must agree
+// with bisection across the freezing range.
+TEST(implicitPermafrost_newton_vs_bisection) {
+  using namespace Amanzi::Flow;
+
+  Teuchos::ParameterList vg_plist;
+  vg_plist.set("van Genuchten m [-]", 0.8);
+  vg_plist.set("van Genuchten alpha [Pa^-1]", 1.5e-4);
+  vg_plist.set("residual saturation [-]", 0.);
+  Teuchos::RCP<WRMVanGenuchten> wrm = Teuchos::rcp(new WRMVanGenuchten(vg_plist));
+
+  Teuchos::ParameterList pc_plist;
+  PCIceWater pcice(pc_plist);
+  double rho = 1000.;
+  double p_atm = 101325.;
+
+  Teuchos::ParameterList bisect_plist;
+  WRMImplicitPermafrostModel bisect(bisect_plist);
+  bisect.set_WRM(wrm);
+
+  Teuchos::ParameterList newton_plist;
+  newton_plist.set("solver algorithm [bisection/toms]", "newton");
+  WRMImplicitPermafrostModel newton(newton_plist);
+  newton.set_WRM(wrm);
+
+  // unsaturated points from just below freezing to well frozen
+  double ps[4] = { 101000., 100000., 95000., 80000. };
+  std::vector<double> pc_liq, pc_ice;
+  for (double T = 273.1; T > 250.; T -= 0.5) {
+    for (double p : ps) {
+      pc_liq.push_back(p_atm - p);
+      pc_ice.push_back(pcice.CapillaryPressure(T, rho));
+    }
+  }
+  int n = pc_liq.size();
+
+  double tol = 1.e-10;
+  double sats[3];
+  std::vector<double> ref_g(n), ref_l(n), ref_i(n);
+  for (int i=0; i!=n; ++i) {
+    bisect.saturations(pc_liq[i], pc_ice[i], sats);
+    ref_g[i] = sats[0];
+    ref_l[i] = sats[1];
+    ref_i[i] = sats[2];
+
+    // scalar Newton, always cold started
+    newton.saturations(pc_liq[i], pc_ice[i], sats);
+    CHECK_CLOSE(ref_g[i], sats[0], tol);
+    CHECK_CLOSE(ref_l[i], sats[1], tol);
+    CHECK_CLOSE(ref_i[i], sats[2], tol);
+  }
+
+  // batched, cold started: no valid guess
+  std::vector<double> s_g(n), s_l(n), s_i(n, -1.);
+  newton.saturations(&pc_liq[0], &pc_ice[0], &s_g[0], &s_l[0], &s_i[0], n);
+  for (int i=0; i!=n; ++i) {
+    CHECK_CLOSE(ref_g[i], s_g[i], tol);
+    CHECK_CLOSE(ref_l[i], s_l[i], tol);
+    CHECK_CLOSE(ref_i[i], s_i[i], tol);
+  }
+
+  // batched, warm started from the solution half a degree warmer, as after
+  // a time step
+  for (int i=0; i!=n; ++i) s_i[i] = i < 4 ? 0. : ref_i[i-4];
+  newton.saturations(&pc_liq[0], &pc_ice[0], &s_g[0], &s_l[0], &s_i[0], n);
+  for (int i=0; i!=n; ++i) {
+    CHECK_CLOSE(ref_g[i], s_g[i], tol);
+    CHECK_CLOSE(ref_l[i], s_l[i], tol);
+    CHECK_CLOSE(ref_i[i], s_i[i], tol);
+  }
+
+  // warm starting may be turned off, in which case guesses are ignored
+  newton_plist.set("warm start from previous ice saturation", false);
+  WRMImplicitPermafrostModel newton_cold(newton_plist);
+  newton_cold.set_WRM(wrm);
+  s_i.assign(n, 0.999);
+  newton_cold.saturations(&pc_liq[0], &pc_ice[0], &s_g[0], &s_l[0], &s_i[0], n);
+  for (int i=0; i!=n; ++i) {
+    CHECK_CLOSE(ref_i[i], s_i[i], tol);
+  }
+}
@@ -0,0 +1,39 @@
+#include <cmath>
+#include "UnitTest++.h"
+
+#include "wrm_van_genuchten.hh"
+#include "wrm_tabulated.hh"
+
+TEST(tabulated_vanGenuchten) {
+  using namespace Amanzi::Flow;
+
+  double rel_err = 1.e-6;
+
+  Teuchos::ParameterList plist;
+  plist.set("WRM Type", "tabulated");
+  plist.set("maximum capillary pressure [Pa]", 1.e6);
+  plist.set("capillary pressure breakpoints [Pa]", Teuchos::Array<double>(1, 100.));
+  plist.set("maximum relative error [-]", rel_err);
+  Teuchos::ParameterList& vg_list = plist.sublist("tabulated WRM");
+  vg_list.set("WRM Type", "van Genuchten");
+  vg_list.set("van Genuchten alpha [Pa^-1]", 2.e-4);
+  vg_list.set("van Genuchten m [-]", 0.5);
+  vg_list.set("residual saturation [-]", 0.1);
+  vg_list.set("saturation smoothing interval [Pa]", 100.);
+
+  WRMTabulated tab(plist);
+  WRMVanGenuchten vG(vg_list);
+
+  // saturation and its derivative are within the bound across the table
+  for (double pc = 0.; pc <= 1.e6; pc += 997.) {
+    double s = vG.saturation(pc);
+    CHECK_CLOSE(tab.saturation(pc), s, rel_err * std::abs(s));
+    double ds = vG.d_saturation(pc);
+    CHECK_CLOSE(tab.d_saturation(pc), ds, rel_err * std::abs(ds) + 1.e-12);
+  }
+
+  // outside of the table, the wrapped model is used
+  CHECK_EQUAL(tab.saturation(-1.e3), vG.saturation(-1.e3));
+  CHECK_EQUAL(tab.saturation(2.e6), vG.saturation(2.e6));
+  CHECK_EQUAL(tab.capillaryPressure(0.5), vG.capillaryPressure(0.5));
+}
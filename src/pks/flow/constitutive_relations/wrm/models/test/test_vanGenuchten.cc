@@ -59,3 +59,31 @@ TEST(vanGenuchten) {
   CHECK_CLOSE(vG.d_capillaryPressure( vG.saturation(pc) ),
               1.0 / vG.d_saturation(pc), 1.);
 }
+
+
+TEST(vanGenuchten_batched) {
+  using namespace Amanzi::Flow;
+
+  Teuchos::ParameterList plist;
+  plist.set("van Genuchten m [-]", 0.5);
+  plist.set("van Genuchten alpha [Pa^-1]", 1.e-4);
+  plist.set("residual saturation [-]", 0.1);
+  plist.set("smoothing interval width [saturation]", 0.05);
+  plist.set("saturation smoothing interval [Pa]", 100.);
+  WRMVanGenuchten vG(plist);
+
+  // batched evaluation must match the scalar model exactly, including the
+  // smoothed intervals and the saturated region
+  const int n = 7;
+  double pc[n] = { -1.e5, 0., 50., 100., 1.e3, 1.e4, 1.e6 };
+  double sat[n], dsat[n], kr[n];
+  vG.saturation(pc, sat, n);
+  vG.d_saturation(pc, dsat, n);
+  vG.k_relative(sat, kr, n);
+
+  for (int i=0; i!=n; ++i) {
+    CHECK_EQUAL(vG.saturation(pc[i]), sat[i]);
+    CHECK_EQUAL(vG.d_saturation(pc[i]), dsat[i]);
+    CHECK_EQUAL(vG.k_relative(sat[i]), kr[i]);
+  }
+}
@@ -6,6 +6,7 @@
   Authors: Ethan Coon (ecoon@lanl.gov)
 */
 
+#include "surface_subsurface_index_map.hh"
 #include "rel_perm_evaluator.hh"
 
 namespace Amanzi {
@@ -175,9 +176,11 @@ void RelPermEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   Epetra_MultiVector& res_c = *result->ViewComponent("cell",false);
 
   int ncells = res_c.MyLength();
+  ForEachWRMRun(*wrms_, ncells, [&](WRM& wrm, int c0, int n) {
+      wrm.k_relative(&sat_c[0][c0], &res_c[0][c0], n);
+    });
   for (unsigned int c=0; c!=ncells; ++c) {
-    int index = (*wrms_->first)[c];
-    res_c[0][c] = std::max(wrms_->second[index]->k_relative(sat_c[0][c]), min_val_);
+    res_c[0][c] = std::max(res_c[0][c], min_val_);
   }
 
   // -- Potentially evaluate the model on boundary faces as well.
@@ -226,18 +229,12 @@ void RelPermEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
         ->ViewComponent("cell",false);
     Epetra_MultiVector& res_bf = *result->ViewComponent("boundary_face",false);
 
-    Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh = S->GetMesh(surf_domain_);
-    Teuchos::RCP<const AmanziMesh::Mesh> mesh = result->Mesh();
-    const Epetra_Map& vandelay_map = mesh->exterior_face_map(false);
-    const Epetra_Map& face_map = mesh->face_map(false);
-    
-    unsigned int nsurf_cells = surf_mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-    for (unsigned int sc=0; sc!=nsurf_cells; ++sc) {
-      // need to map from surface quantity on cells to subsurface boundary_face quantity
-      AmanziMesh::Entity_ID f = surf_mesh->entity_get_parent(AmanziMesh::CELL, sc);
-      AmanziMesh::Entity_ID bf = vandelay_map.LID(face_map.GID(f));
-
-      res_bf[0][bf] = std::max(surf_kr[0][sc], min_val_);
+    // need to map from surface quantity on cells to subsurface boundary_face quantity
+    const std::vector<int>& bfs = GetSurfaceSubsurfaceIndexMap(
+        S->GetMesh(surf_domain_), result->Mesh()).boundary_faces();
+    int nsurf_cells = bfs.size();
+    for (int sc=0; sc!=nsurf_cells; ++sc) {
+      res_bf[0][bfs[sc]] = std::max(surf_kr[0][sc], min_val_);
     }
   }
 
@@ -293,9 +290,10 @@ void RelPermEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>
     Epetra_MultiVector& res_c = *result->ViewComponent("cell",false);
 
     int ncells = res_c.MyLength();
+    ForEachWRMRun(*wrms_, ncells, [&](WRM& wrm, int c0, int n) {
+        wrm.d_k_relative(&sat_c[0][c0], &res_c[0][c0], n);
+      });
     for (unsigned int c=0; c!=ncells; ++c) {
-      int index = (*wrms_->first)[c];
-      res_c[0][c] = wrms_->second[index]->d_k_relative(sat_c[0][c]);
       AMANZI_ASSERT(res_c[0][c] >= 0.);
     }
 
@@ -352,19 +350,11 @@ void RelPermEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>
           ->ViewComponent("cell",false);
       Epetra_MultiVector& res_bf = *result->ViewComponent("boundary_face",false);
 
-      Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh = S->GetMesh(surf_domain_);
-      Teuchos::RCP<const AmanziMesh::Mesh> mesh = result->Mesh();
-      const Epetra_Map& vandelay_map = mesh->exterior_face_map(false);
-      const Epetra_Map& face_map = mesh->face_map(false);
-    
-      unsigned int nsurf_cells = surf_mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
-      for (unsigned int sc=0; sc!=nsurf_cells; ++sc) {
-        // need to map from surface quantity on cells to subsurface boundary_face quantity
-        AmanziMesh::Entity_ID f = surf_mesh->entity_get_parent(AmanziMesh::CELL, sc);
-        AmanziMesh::Entity_ID bf = vandelay_map.LID(face_map.GID(f));
-
-        //        res_bf[0][bf] = std::max(surf_kr[0][sc], min_val_);
-        res_bf[0][bf] = 0.;
+      const std::vector<int>& bfs = GetSurfaceSubsurfaceIndexMap(
+          S->GetMesh(surf_domain_), result->Mesh()).boundary_faces();
+      int nsurf_cells = bfs.size();
+      for (int sc=0; sc!=nsurf_cells; ++sc) {
+        res_bf[0][bfs[sc]] = 0.;
       }
     }
 
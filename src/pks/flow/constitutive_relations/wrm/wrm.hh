@@ -35,6 +35,21 @@ public:
   virtual double d_capillaryPressure(double saturation) = 0;
   virtual double residualSaturation() = 0;
 
+  // Batched versions, evaluating n contiguous entries which share this WRM.
+  // The defaults simply loop over the scalar versions; models may override
+  // these with kernels that avoid the per-entry virtual call.
+  virtual void k_relative(const double* s, double* kr, int n) {
+    for (int i=0; i!=n; ++i) kr[i] = k_relative(s[i]);
+  }
+  virtual void d_k_relative(const double* s, double* dkr, int n) {
+    for (int i=0; i!=n; ++i) dkr[i] = d_k_relative(s[i]);
+  }
+  virtual void saturation(const double* pc, double* s, int n) {
+    for (int i=0; i!=n; ++i) s[i] = saturation(pc[i]);
+  }
+  virtual void d_saturation(const double* pc, double* ds, int n) {
+    for (int i=0; i!=n; ++i) ds[i] = d_saturation(pc[i]);
+  }
 };
 
 typedef double(WRM::*KRelFn)(double pc);
@@ -85,11 +85,11 @@ void WRMEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   const Epetra_MultiVector& pres_c = *S->GetFieldData(cap_pres_key_)
       ->ViewComponent("cell",false);
 
-  // calculate cell values
+  // calculate cell values, batched over runs of cells sharing a WRM
   AmanziMesh::Entity_ID ncells = sat_c.MyLength();
-  for (AmanziMesh::Entity_ID c=0; c!=ncells; ++c) {
-    sat_c[0][c] = wrms_->second[(*wrms_->first)[c]]->saturation(pres_c[0][c]);
-  }
+  ForEachWRMRun(*wrms_, ncells, [&](WRM& wrm, int c0, int n) {
+      wrm.saturation(&pres_c[0][c0], &sat_c[0][c0], n);
+    });
 
   // Potentially do face values as well.
   if (results[0]->HasComponent("boundary_face")) {
@@ -152,11 +152,11 @@ void WRMEvaluator::EvaluateFieldPartialDerivative_(const Teuchos::Ptr<State>& S,
   const Epetra_MultiVector& pres_c = *S->GetFieldData(cap_pres_key_)
       ->ViewComponent("cell",false);
 
-  // calculate cell values
+  // calculate cell values, batched over runs of cells sharing a WRM
   AmanziMesh::Entity_ID ncells = sat_c.MyLength();
-  for (AmanziMesh::Entity_ID c=0; c!=ncells; ++c) {
-    sat_c[0][c] = wrms_->second[(*wrms_->first)[c]]->d_saturation(pres_c[0][c]);
-  }
+  ForEachWRMRun(*wrms_, ncells, [&](WRM& wrm, int c0, int n) {
+      wrm.d_saturation(&pres_c[0][c0], &sat_c[0][c0], n);
+    });
 
   // Potentially do face values as well.
   if (results[0]->HasComponent("boundary_face")) {
@@ -29,7 +29,21 @@ WRMImplicitPermafrostModel::WRMImplicitPermafrostModel(Teuchos::ParameterList& p
   eps_ = plist_.get<double>("converged tolerance", 1.e-12);
   max_it_ = plist_.get<int>("max iterations", 100);
   deriv_regularization_ = plist_.get<double>("minimum dsi_dpressure magnitude", 1.e-10);
-  solver_ = plist_.get<std::string>("solver algorithm [bisection/toms]", "bisection");
+  warm_start_ = plist_.get<bool>("warm start from previous ice saturation", true);
+
+  std::string solver = plist_.get<std::string>("solver algorithm [bisection/toms]", "bisection");
+  if (solver == "bisection") {
+    solver_ = SOLVER_BISECTION;
+  } else if (solver == "toms") {
+    solver_ = SOLVER_TOMS;
+  } else if (solver == "newton") {
+    solver_ = SOLVER_NEWTON;
+  } else {
+    Errors::Message emsg;
+    emsg << "WRMImplicitPermafrostModel: unknown solver algorithm \"" << solver
+         << "\", valid are \"bisection\", \"toms\", and \"newton\"";
+    Exceptions::amanzi_throw(emsg);
+  }
 }
 
 // Above freezing calculation methods:
@@ -165,18 +179,26 @@ double WRMImplicitPermafrostModel::si_frozen_unsaturated_(double pc_liq, double
     // outside of the spline
     si = si_frozen_unsaturated_nospline_(pc_liq, pc_ice);
   } else {
-    // fit spline, evaluate
-    double spline[4];
-    FitSpline_(pc_ice, cutoff, si_cutoff, spline);
-    si = ((spline[0] * pc_liq + spline[1]) * pc_liq + spline[2]) * pc_liq + spline[3];
-    si = std::max(si, 0.);
-    AMANZI_ASSERT(si <= 1.);
+    si = si_spline_(pc_liq, pc_ice, cutoff, si_cutoff);
   }
 
   return si;
 }
 
 
+// -- si calculation, within the splined region
+double WRMImplicitPermafrostModel::si_spline_(double pc_liq, double pc_ice,
+        double cutoff, double si_cutoff) {
+  // fit spline, evaluate
+  double spline[4];
+  FitSpline_(pc_ice, cutoff, si_cutoff, spline);
+  double si = ((spline[0] * pc_liq + spline[1]) * pc_liq + spline[2]) * pc_liq + spline[3];
+  si = std::max(si, 0.);
+  AMANZI_ASSERT(si <= 1.);
+  return si;
+}
+
+
 // -- dsi_dpcliq calculation, partially frozen, unsaturated
 double WRMImplicitPermafrostModel::dsi_dpc_liq_frozen_unsaturated_(double pc_liq,
         double pc_ice, double si) {
@@ -308,6 +330,12 @@ bool WRMImplicitPermafrostModel::FitSpline_(double pc_ice, double cutoff,
 // -- si calculation, outside of the splined region
 double WRMImplicitPermafrostModel::si_frozen_unsaturated_nospline_(double pc_liq,
         double pc_ice, bool throw_ok) {
+  if (solver_ == SOLVER_NEWTON) {
+    double si;
+    si_frozen_unsaturated_nospline_(1, &pc_liq, &pc_ice, NULL, &si, throw_ok);
+    return si;
+  }
+
   // solve implicit equation for s_i
   SatIceFunctor_ func(pc_liq, pc_ice, wrm_);
   Tol_ tol(eps_);
@@ -317,14 +345,11 @@ double WRMImplicitPermafrostModel::si_frozen_unsaturated_nospline_(double pc_liq
 
   std::pair<double,double> result;
   try {
-    if (solver_ == "bisection") {
+    if (solver_ == SOLVER_BISECTION) {
       result = boost::math::tools::bisect(func, left, right, tol, max_it);
-    } else if (solver_ == "toms") {
+    } else {
       result =
           boost::math::tools::toms748_solve(func, left, right, tol, max_it);
-    } else {
-      Errors::Message emsg("Unknown solver method");
-      Exceptions::amanzi_throw(emsg);
     }
   } catch (const std::exception& e) {
     // this throw should not be caught
@@ -352,6 +377,80 @@ double WRMImplicitPermafrostModel::si_frozen_unsaturated_nospline_(double pc_liq
 }
 
 
+// -- si calculation for n points outside of the splined region, by a
+//    safeguarded Newton iteration on all points in lockstep.  The residual
+//
+//      f(si) = (1 - si) S*(pc_liq) - S*(pc_ice + Pc((1 - si) S*(pc_liq) + si))
+//
+//    is decreasing in si, with f(0) > 0 > f(1), so the root stays bracketed.
+//    Newton steps that leave the bracket are replaced by bisection.  Guesses,
+//    if provided and within (0,1), are used as starting points.  Returns the
+//    number of points that did not converge.
+int WRMImplicitPermafrostModel::si_frozen_unsaturated_nospline_(int n,
+        const double* pc_liq, const double* pc_ice, const double* si_guess,
+        double* si, bool throw_ok) {
+  sstar_.resize(n);
+  lo_.assign(n, 0.);
+  hi_.assign(n, 1.);
+  active_.resize(n);
+  arg_.resize(n);
+  s_arg_.resize(n);
+  ds_arg_.resize(n);
+  dpc_.resize(n);
+
+  wrm_->saturation(pc_liq, &sstar_[0], n);
+  for (int i=0; i!=n; ++i) {
+    si[i] = (si_guess && si_guess[i] > 0. && si_guess[i] < 1.) ? si_guess[i] : 0.5;
+    active_[i] = i;
+  }
+
+  int nactive = n;
+  for (boost::uintmax_t it=0; it < max_it_ && nactive > 0; ++it) {
+    // arguments of the outer saturation curve
+    for (int k=0; k!=nactive; ++k) {
+      int i = active_[k];
+      double x = (1.0 - si[i]) * sstar_[i] + si[i];
+      arg_[k] = pc_ice[i] + wrm_->capillaryPressure(x);
+      dpc_[k] = wrm_->d_capillaryPressure(x);
+    }
+    wrm_->saturation(&arg_[0], &s_arg_[0], nactive);
+    wrm_->d_saturation(&arg_[0], &ds_arg_[0], nactive);
+
+    // update, keeping only the points that have not converged
+    int nnext = 0;
+    for (int k=0; k!=nactive; ++k) {
+      int i = active_[k];
+      double f = (1.0 - si[i]) * sstar_[i] - s_arg_[k];
+      if (std::abs(f) <= eps_) continue;
+
+      if (f > 0.) lo_[i] = si[i];
+      else hi_[i] = si[i];
+
+      double dfdsi = -sstar_[i] - ds_arg_[k] * dpc_[k] * (1.0 - sstar_[i]);
+      double si_new = dfdsi < 0. ? si[i] - f / dfdsi : -1.;
+      if (!(si_new > lo_[i] && si_new < hi_[i])) si_new = (lo_[i] + hi_[i]) / 2.;
+
+      double step = std::abs(si_new - si[i]);
+      si[i] = si_new;
+      if (step > eps_ && hi_[i] - lo_[i] > eps_) active_[nnext++] = i;
+    }
+    nactive = nnext;
+  }
+
+  for (int k=0; k!=nactive; ++k) {
+    int i = active_[k];
+    std::cout << "WRMImplicitPermafrostModel did not converge, " << max_it_
+              << " iterations, bracket = [" << lo_[i] << "," << hi_[i]
+              << "], s_i = " << si[i]
+              << ", PC_{lg,il} = " << pc_liq[i] << "," << pc_ice[i] << std::endl;
+  }
+  if (nactive > 0 && throw_ok) {
+    Exceptions::amanzi_throw(Errors::CutTimeStep());
+  }
+  return nactive;
+}
+
+
 // -- dsi_dpcliq calculation, outside of the splined region
 double WRMImplicitPermafrostModel::dsi_dpc_liq_frozen_unsaturated_nospline_(double pc_liq,
         double pc_ice, double si) {
@@ -393,6 +492,71 @@ void WRMImplicitPermafrostModel::saturations(double pc_liq, double pc_ice,
   return;
 }
 
+// Calculate the saturation for n points.  Points that need the implicit
+// solve are gathered, and with the Newton solver are solved together,
+// starting from the incoming ice saturation if warm starting.
+void WRMImplicitPermafrostModel::saturations(const double* pc_liq, const double* pc_ice,
+        double* s_gas, double* s_liq, double* s_ice, int n) {
+  batch_index_.clear();
+  batch_pc_liq_.clear();
+  batch_pc_ice_.clear();
+  batch_guess_.clear();
+
+  double sats[3];
+  for (int i=0; i!=n; ++i) {
+    bool done = sats_unfrozen_(pc_liq[i], pc_ice[i], sats) ||
+        sats_saturated_(pc_liq[i], pc_ice[i], sats);
+
+    if (!done) {
+      double cutoff(0.), si_cutoff(0.);
+      DetermineSplineCutoff_(pc_liq[i], pc_ice[i], cutoff, si_cutoff);
+      if (pc_liq[i] > cutoff) {
+        // outside of the spline, solve later
+        batch_index_.push_back(i);
+        batch_pc_liq_.push_back(pc_liq[i]);
+        batch_pc_ice_.push_back(pc_ice[i]);
+        batch_guess_.push_back(warm_start_ ? s_ice[i] : -1.);
+        continue;
+      }
+
+      double si = si_spline_(pc_liq[i], pc_ice[i], cutoff, si_cutoff);
+      sats[2] = si;
+      sats[1] = (1. - si) * wrm_->saturation(pc_liq[i]);
+      sats[0] = 1. - si - sats[1];
+    }
+    s_gas[i] = sats[0];
+    s_liq[i] = sats[1];
+    s_ice[i] = sats[2];
+  }
+
+  int m = batch_index_.size();
+  if (m == 0) return;
+
+  batch_si_.resize(m);
+  if (solver_ == SOLVER_NEWTON) {
+    si_frozen_unsaturated_nospline_(m, &batch_pc_liq_[0], &batch_pc_ice_[0],
+            &batch_guess_[0], &batch_si_[0]);
+  } else {
+    for (int k=0; k!=m; ++k) {
+      batch_si_[k] = si_frozen_unsaturated_nospline_(batch_pc_liq_[k], batch_pc_ice_[k]);
+    }
+  }
+
+  // liquid saturation of the solved points, reusing the workspace
+  sstar_.resize(m);
+  wrm_->saturation(&batch_pc_liq_[0], &sstar_[0], m);
+  for (int k=0; k!=m; ++k) {
+    int i = batch_index_[k];
+    double si = batch_si_[k];
+    s_ice[i] = si;
+    s_liq[i] = (1. - si) * sstar_[k];
+    s_gas[i] = 1. - si - s_liq[i];
+    AMANZI_ASSERT(s_gas[i] >= 0.);
+    AMANZI_ASSERT(s_liq[i] >= 0.);
+    AMANZI_ASSERT(s_ice[i] >= 0.);
+  }
+}
+
 void WRMImplicitPermafrostModel::dsaturations_dpc_liq(double pc_liq, double pc_ice,
         double (&dsats)[3]) {
   if (dsats_dpc_liq_unfrozen_(pc_liq, pc_ice, dsats)) return;
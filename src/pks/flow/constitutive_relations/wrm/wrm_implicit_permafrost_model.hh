@@ -14,13 +14,21 @@
 
     * `"converged tolerance`" ``[double]`` **1.e-12** Convergence tolerance of the implicit solve.
     * `"max iterations`" ``[int]`` **100** Maximum allowable iterations of the implicit solve.
-    * `"solver algorithm [bisection/toms]`" ``[string]`` **bisection** Use bisection or the TOMS algorithm from boost.
+    * `"solver algorithm [bisection/toms]`" ``[string]`` **bisection** Use
+      bisection or the TOMS algorithm from boost, or `"newton`", a safeguarded
+      Newton iteration kept within a bisection bracket.  The `"newton`" solver
+      is evaluated in batches over cells and may be warm started.
+    * `"warm start from previous ice saturation`" ``[bool]`` **true** With the
+      `"newton`" solver, start the implicit solve from the current ice
+      saturation (the previous iterate) when it is a valid guess.
 
 */
 
 #ifndef AMANZI_FLOWRELATIONS_WRM_IMPLICIT_PERMAFROST_MODEL_
 #define AMANZI_FLOWRELATIONS_WRM_IMPLICIT_PERMAFROST_MODEL_
 
+#include <vector>
+
 #include "boost/cstdint.hpp"
 #include "boost/math/tools/roots.hpp"
 #include "boost/cstdint.hpp"
@@ -46,6 +54,11 @@ class WRMImplicitPermafrostModel : public WRMPermafrostModel {
   virtual void dsaturations_dpc_liq(double pc_liq, double pc_ice, double (&dsats)[3]);
   virtual void dsaturations_dpc_ice(double pc_liq, double pc_ice, double (&dsats)[3]);
 
+  // batched, solving the implicit equation for all frozen, unsaturated
+  // points together
+  virtual void saturations(const double* pc_liq, const double* pc_ice,
+          double* s_gas, double* s_liq, double* s_ice, int n);
+
  protected:
   // calculation if unfrozen
   bool sats_unfrozen_(double pc_liq, double pc_ice, double (&sats)[3]);
@@ -65,10 +78,13 @@ class WRMImplicitPermafrostModel : public WRMPermafrostModel {
           double (&dsats)[3]);
 
   double si_frozen_unsaturated_(double pc_liq, double pc_ice);
+  double si_spline_(double pc_liq, double pc_ice, double cutoff, double si_cutoff);
   double dsi_dpc_liq_frozen_unsaturated_(double pc_liq, double pc_ice, double si);
   double dsi_dpc_ice_frozen_unsaturated_(double pc_liq, double pc_ice, double si);
 
   double si_frozen_unsaturated_nospline_(double pc_liq, double pc_ice, bool throw_ok=false);
+  int si_frozen_unsaturated_nospline_(int n, const double* pc_liq, const double* pc_ice,
+          const double* si_guess, double* si, bool throw_ok=false);
   double dsi_dpc_liq_frozen_unsaturated_nospline_(double pc_liq, double pc_ice,
           double si);
   double dsi_dpc_ice_frozen_unsaturated_nospline_(double pc_liq, double pc_ice,
@@ -82,7 +98,19 @@ class WRMImplicitPermafrostModel : public WRMPermafrostModel {
   double eps_;
   boost::uintmax_t max_it_;
   double deriv_regularization_;
-  std::string solver_;
+  bool warm_start_;
+
+  enum SolverType {
+    SOLVER_BISECTION,
+    SOLVER_TOMS,
+    SOLVER_NEWTON
+  };
+  SolverType solver_;
+
+  // workspace for the batched solve
+  std::vector<int> batch_index_, active_;
+  std::vector<double> batch_pc_liq_, batch_pc_ice_, batch_guess_, batch_si_;
+  std::vector<double> sstar_, lo_, hi_, arg_, s_arg_, ds_arg_, dpc_;
 
  private:
   // Functor for ice saturation, gets used within a root-finding algorithm
@@ -41,6 +41,23 @@ typedef std::pair<Teuchos::RCP<Functions::MeshPartition>, WRMPermafrostModelList
 Teuchos::RCP<WRMPartition>
 createWRMPartition(Teuchos::ParameterList& plist);
 
+// Calls f(wrm, begin, count) on each maximal run of consecutive cells in
+// [0, ncells) that share a WRM.  This allows the batched WRM methods to work
+// directly on contiguous slices of cell vectors, without gathering by region.
+// Works for both WRMPartition and WRMPermafrostModelPartition.
+template<class Partition, class Func>
+void ForEachWRMRun(const Partition& wrms, int ncells, Func f) {
+  const Functions::MeshPartition& part = *wrms.first;
+  int begin = 0;
+  while (begin < ncells) {
+    int index = part[begin];
+    int end = begin + 1;
+    while (end < ncells && part[end] == index) ++end;
+    f(*wrms.second[index], begin, end - begin);
+    begin = end;
+  }
+}
+
 Teuchos::RCP<WRMPermafrostModelPartition>
 createWRMPermafrostModelPartition(Teuchos::ParameterList& plist,
         Teuchos::RCP<WRMPartition>& wrms);
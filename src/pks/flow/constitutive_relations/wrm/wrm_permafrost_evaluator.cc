@@ -167,15 +167,16 @@ void WRMPermafrostEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   const Epetra_MultiVector& pc_ice_c = *S->GetFieldData(pc_ice_key_)
       ->ViewComponent("cell",false);
 
-  double sats[3];
+  // batched over runs of cells sharing a model; the current ice saturation
+  // (the previous iterate) is passed in as a starting guess
   int ncells = satg_c.MyLength();
-  for (AmanziMesh::Entity_ID c=0; c!=ncells; ++c) {
-    int i = (*permafrost_models_->first)[c];
-    permafrost_models_->second[i]->saturations(pc_liq_c[0][c], pc_ice_c[0][c], sats);
-    satg_c[0][c] = sats[0];
-    satl_c[0][c] = sats[1];
-    sati_c[0][c] = sats[2];
-  }
+  ForEachWRMRun(*permafrost_models_, ncells,
+                [&](WRMPermafrostModel& model, int c0, int n) {
+      model.saturations(&pc_liq_c[0][c0], &pc_ice_c[0][c0],
+                        &satg_c[0][c0], &satl_c[0][c0], &sati_c[0][c0], n);
+    });
+
+  double sats[3];
 
   // Potentially do face values as well, though only for saturation_liquid?
   if (results[0]->HasComponent("boundary_face")) {
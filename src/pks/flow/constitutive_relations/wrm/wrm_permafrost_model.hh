@@ -31,6 +31,20 @@ public:
   virtual void dsaturations_dpc_ice(double pc_liq, double pc_ice,
           double (&dsats)[3]) = 0;
 
+  // Batched saturations over n points.  On input, s_ice may hold an estimate
+  // of the result (e.g. the previous iterate), which models that solve an
+  // implicit equation may use as a starting guess.
+  virtual void saturations(const double* pc_liq, const double* pc_ice,
+          double* s_gas, double* s_liq, double* s_ice, int n) {
+    double sats[3];
+    for (int i=0; i!=n; ++i) {
+      saturations(pc_liq[i], pc_ice[i], sats);
+      s_gas[i] = sats[0];
+      s_liq[i] = sats[1];
+      s_ice[i] = sats[2];
+    }
+  }
+
  protected:
   Teuchos::ParameterList plist_;
   Teuchos::RCP<WRM> wrm_;
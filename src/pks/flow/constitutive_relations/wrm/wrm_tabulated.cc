@@ -0,0 +1,45 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! WRMTabulated : a tabulated version of any other water retention model.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include "wrm_factory.hh"
+#include "wrm_tabulated.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+WRMTabulated::WRMTabulated(Teuchos::ParameterList& plist)
+{
+  WRMFactory fac;
+  wrm_ = fac.createWRM(plist.sublist("tabulated WRM"));
+
+  double rel_err = plist.get<double>("maximum relative error [-]", 1.e-8);
+
+  double pc_min = plist.get<double>("minimum capillary pressure [Pa]", 0.);
+  double pc_max = plist.get<double>("maximum capillary pressure [Pa]", 1.e7);
+  auto pc_breakpoints = plist.get<Teuchos::Array<double> >("capillary pressure breakpoints [Pa]",
+          Teuchos::Array<double>()).toVector();
+  sat_ = Teuchos::rcp(new Relations::TabulatedFunction(
+      [this](double pc) { return wrm_->saturation(pc); },
+      [this](double pc) { return wrm_->d_saturation(pc); },
+      pc_min, pc_max, rel_err, pc_breakpoints));
+
+  if (plist.get<bool>("tabulate relative permeability", false)) {
+    auto s_breakpoints = plist.get<Teuchos::Array<double> >("saturation breakpoints [-]",
+            Teuchos::Array<double>()).toVector();
+    kr_ = Teuchos::rcp(new Relations::TabulatedFunction(
+        [this](double s) { return wrm_->k_relative(s); },
+        [this](double s) { return wrm_->d_k_relative(s); },
+        wrm_->residualSaturation(), 1.0, rel_err, s_breakpoints));
+  }
+}
+
+} //namespace
+} //namespace
@@ -0,0 +1,115 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! WRMTabulated : a tabulated version of any other water retention model.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+/*!
+
+Wraps another water retention model, sampling saturation as a function of
+capillary pressure, and optionally relative permeability as a function of
+saturation, onto adaptive tables at setup.  See TabulatedFunction.  Values
+and derivatives inside the tabulated ranges are served from the tables;
+everything else is passed on to the wrapped model.
+
+Relative permeability is not tabulated by default, as models without a
+smoothing interval have an unbounded derivative at saturation 1.
+
+Models with piecewise definitions, such as the smoothing intervals of van
+Genuchten, should list the ends of those intervals as breakpoints.
+
+.. _wrm-tabulated-spec
+.. admonition:: wrm-tabulated-spec
+
+    * `"tabulated WRM`" ``[WRM-spec]`` The model to tabulate.
+    * `"minimum capillary pressure [Pa]`" ``[double]`` **0.**
+    * `"maximum capillary pressure [Pa]`" ``[double]`` **1.e7**
+    * `"capillary pressure breakpoints [Pa]`" ``[Array(double)]`` **{}**
+    * `"tabulate relative permeability`" ``[bool]`` **false**
+    * `"saturation breakpoints [-]`" ``[Array(double)]`` **{}**
+    * `"maximum relative error [-]`" ``[double]`` **1.e-8** Bound on the error
+      of values and derivatives, checked against the wrapped model at setup.
+
+Example:
+
+.. code-block:: xml
+
+    <ParameterList name="moss" type="ParameterList">
+      <Parameter name="region" type="string" value="moss" />
+      <Parameter name="WRM Type" type="string" value="tabulated" />
+      <Parameter name="maximum relative error [-]" type="double" value="1.e-8" />
+      <ParameterList name="tabulated WRM" type="ParameterList">
+        <Parameter name="WRM Type" type="string" value="van Genuchten" />
+        <Parameter name="van Genuchten alpha [Pa^-1]" type="double" value="0.002" />
+        <Parameter name="van Genuchten m [-]" type="double" value="0.2" />
+        <Parameter name="residual saturation [-]" type="double" value="0.0" />
+      </ParameterList>
+    </ParameterList>
+
+*/
+
+#ifndef ATS_FLOWRELATIONS_WRM_TABULATED_
+#define ATS_FLOWRELATIONS_WRM_TABULATED_
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "TabulatedFunction.hh"
+#include "wrm.hh"
+#include "Factory.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+class WRMTabulated : public WRM {
+
+public:
+  explicit WRMTabulated(Teuchos::ParameterList& plist);
+
+  // required methods from the base class
+  virtual double k_relative(double s) {
+    return (kr_ != Teuchos::null && kr_->InRange(s)) ? kr_->Value(s) : wrm_->k_relative(s);
+  }
+  virtual double d_k_relative(double s) {
+    return (kr_ != Teuchos::null && kr_->InRange(s)) ? kr_->Derivative(s) : wrm_->d_k_relative(s);
+  }
+  virtual double saturation(double pc) {
+    return sat_->InRange(pc) ? sat_->Value(pc) : wrm_->saturation(pc);
+  }
+  virtual double d_saturation(double pc) {
+    return sat_->InRange(pc) ? sat_->Derivative(pc) : wrm_->d_saturation(pc);
+  }
+  virtual double capillaryPressure(double s) { return wrm_->capillaryPressure(s); }
+  virtual double d_capillaryPressure(double s) { return wrm_->d_capillaryPressure(s); }
+  virtual double residualSaturation() { return wrm_->residualSaturation(); }
+
+  // batched versions avoid the virtual call per entry
+  virtual void k_relative(const double* s, double* kr, int n) {
+    for (int i=0; i!=n; ++i) kr[i] = WRMTabulated::k_relative(s[i]);
+  }
+  virtual void d_k_relative(const double* s, double* dkr, int n) {
+    for (int i=0; i!=n; ++i) dkr[i] = WRMTabulated::d_k_relative(s[i]);
+  }
+  virtual void saturation(const double* pc, double* s, int n) {
+    for (int i=0; i!=n; ++i) s[i] = WRMTabulated::saturation(pc[i]);
+  }
+  virtual void d_saturation(const double* pc, double* ds, int n) {
+    for (int i=0; i!=n; ++i) ds[i] = WRMTabulated::d_saturation(pc[i]);
+  }
+
+ private:
+  Teuchos::RCP<WRM> wrm_;
+  Teuchos::RCP<Relations::TabulatedFunction> sat_;
+  Teuchos::RCP<Relations::TabulatedFunction> kr_;
+
+  static Utils::RegisteredFactory<WRM,WRMTabulated> factory_;
+};
+
+} //namespace
+} //namespace
+
+#endif
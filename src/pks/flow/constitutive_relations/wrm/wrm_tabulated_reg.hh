@@ -0,0 +1,21 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+//! WRMTabulated : a tabulated version of any other water retention model.
+
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Authors: Ethan Coon (ecoon@lanl.gov)
+*/
+
+#include "wrm_tabulated.hh"
+
+namespace Amanzi {
+namespace Flow {
+
+// registry of method
+Utils::RegisteredFactory<WRM,WRMTabulated> WRMTabulated::factory_("tabulated");
+
+}  // namespace
+}  // namespace
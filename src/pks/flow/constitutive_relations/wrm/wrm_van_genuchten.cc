@@ -132,6 +132,79 @@ double WRMVanGenuchten::d_capillaryPressure(double s) {
 }
 
 
+/* ******************************************************************
+ * Batched relative permeability.  The closed form is evaluated in a
+ * branch-free loop with the Krel function chosen once; entries in the
+ * smoothing interval are patched afterwards.  Results are identical to
+ * the scalar version.
+ ****************************************************************** */
+void WRMVanGenuchten::k_relative(const double* s, double* kr, int n) {
+  const double sr = sr_;
+  const double m = m_;
+  const double l = l_;
+  if (function_ == FLOW_WRM_MUALEM) {
+    for (int i=0; i!=n; ++i) {
+      double se = (s[i] - sr)/(1-sr);
+      kr[i] = pow(se, l) * pow(1.0 - pow(1.0 - pow(se, 1.0/m), m), 2.0);
+    }
+  } else {
+    for (int i=0; i!=n; ++i) {
+      double se = (s[i] - sr)/(1-sr);
+      kr[i] = se * se * (1.0 - pow(1.0 - pow(se, 1.0/m), m));
+    }
+  }
+
+  for (int i=0; i!=n; ++i) {
+    if (s[i] > s0_) kr[i] = (s[i] == 1.0) ? 1.0 : fit_kr_(s[i]);
+  }
+}
+
+
+/* ******************************************************************
+ * Batched saturation.
+ ****************************************************************** */
+void WRMVanGenuchten::saturation(const double* pc, double* s, int n) {
+  const double alpha = alpha_;
+  const double n_vg = n_;
+  const double m = m_;
+  const double sr = sr_;
+  const double pc0 = pc0_;
+  for (int i=0; i!=n; ++i) {
+    double s_vg = std::pow(1.0 + std::pow(alpha*pc[i], n_vg), -m) * (1.0 - sr) + sr;
+    s[i] = pc[i] > pc0 ? s_vg : 1.0;
+  }
+
+  if (pc0 > 0.) {
+    for (int i=0; i!=n; ++i) {
+      if (pc[i] > 0. && pc[i] <= pc0) s[i] = fit_s_(pc[i]);
+    }
+  }
+}
+
+
+/* ******************************************************************
+ * Batched derivative of saturation w.r.t. capillary pressure.
+ ****************************************************************** */
+void WRMVanGenuchten::d_saturation(const double* pc, double* ds, int n) {
+  const double alpha = alpha_;
+  const double n_vg = n_;
+  const double m = m_;
+  const double sr = sr_;
+  const double pc0 = pc0_;
+  for (int i=0; i!=n; ++i) {
+    double ds_vg = -m*n_vg * std::pow(1.0 + std::pow(alpha*pc[i], n_vg), -m-1.0)
+                   * std::pow(alpha*pc[i], n_vg-1) * alpha * (1.0 - sr);
+    ds[i] = pc[i] > pc0 ? ds_vg : 0.0;
+  }
+
+  if (pc0 > 0.) {
+    for (int i=0; i!=n; ++i) {
+      if (pc[i] > 0. && pc[i] <= pc0) ds[i] = fit_s_.Derivative(pc[i]);
+    }
+  }
+}
+
+
 void WRMVanGenuchten::InitializeFromPlist_() {
   std::string fname = plist_.get<std::string>("Krel function name", "Mualem");
   if (fname == std::string("Mualem")) {
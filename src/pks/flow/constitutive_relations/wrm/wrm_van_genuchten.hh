@@ -70,6 +70,11 @@ public:
   double d_capillaryPressure(double saturation);
   double residualSaturation() { return sr_; }
 
+  // batched methods, with the Mualem/Burdine branch hoisted out of the loop
+  void k_relative(const double* s, double* kr, int n);
+  void saturation(const double* pc, double* s, int n);
+  void d_saturation(const double* pc, double* ds, int n);
+
  private:
   void InitializeFromPlist_();
 
@@ -131,6 +131,7 @@ Solves the diffusion wave equation for overland flow with pressure as a primary
 #include "BoundaryFunction.hh"
 #include "DynamicBoundaryFunction.hh"
 #include "upwinding.hh"
+#include "boundary_face_plan.hh"
 
 #include "Operator.hh"
 #include "PDE_Diffusion.hh"
@@ -319,6 +320,7 @@ protected:
   Teuchos::RCP<Functions::BoundaryFunction> bc_tidal_;
   Teuchos::RCP<Functions::DynamicBoundaryFunction> bc_dynamic_;
   Teuchos::RCP<Functions::BoundaryFunction> bc_level_flux_lvl_, bc_level_flux_vel_ ;
+  Teuchos::RCP<BoundaryFacePlan> bc_plan_;
 
   // needed physical models
   Teuchos::RCP<Flow::OverlandConductivityModel> cond_model_;
@@ -176,6 +176,7 @@ void OverlandPressureFlow::SetupOverlandFlow_(const Teuchos::Ptr<State>& S)
 
   bc_level_flux_lvl_ = bc_factory.CreateFixedLevelFlux_Level();
   bc_level_flux_vel_ = bc_factory.CreateFixedLevelFlux_Velocity();
+  bc_plan_ = Teuchos::rcp(new BoundaryFacePlan(mesh_));
 
   // -- nonlinear coefficients and upwinding
   Teuchos::ParameterList upwind_plist = plist_->sublist("upwinding");
@@ -748,8 +749,6 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
   auto& markers = bc_markers();
   auto& values = bc_values();
 
-  AmanziMesh::Entity_ID_List cells;
-
   S->GetFieldEvaluator(elev_key_)->HasFieldChanged(S, name_);
   const Epetra_MultiVector& elevation = *S->GetFieldData(elev_key_)
       ->ViewComponent("face",false);
@@ -785,10 +784,11 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
       const Epetra_MultiVector& eta = *S->GetFieldData(Keys::getKey(domain_,"unfrozen_fraction"))->ViewComponent("cell");
       const Epetra_MultiVector& rho_i = *S->GetFieldData(Keys::getKey(domain_,"mass_density_ice"))->ViewComponent("cell");
 
+      const auto& recs = bc_plan_->Records(*bc_pressure_);
+      int i = 0;
       for (const auto& bc : *bc_pressure_) {
         int f = bc.first;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-        int c = cells[0];
+        int c = recs[i++].c;
 
         double p0 = bc.second > p_atm ? bc.second : p_atm;
         double h0 = (p0 - p_atm) / ((eta[0][c]*rho_l[0][c] + (1.-eta[0][c])*rho_i[0][c]) * gz);
@@ -799,10 +799,11 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
 
     } else {
       // non-thermal model
+      const auto& recs = bc_plan_->Records(*bc_pressure_);
+      int i = 0;
       for (const auto& bc : *bc_pressure_) {
         int f = bc.first;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-        int c = cells[0];
+        int c = recs[i++].c;
 
         double p0 = bc.second > p_atm ? bc.second : p_atm;
         double h0 = (p0 - p_atm) / (rho_l[0][c] * gz);
@@ -871,10 +872,11 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
                                        ->ViewComponent("cell");
     double gz = -(*S->GetConstantVectorData("gravity"))[2];
 
+    const auto& recs = bc_plan_->Records(*bc_critical_depth_);
+    int i = 0;
     for (const auto& bc : *bc_critical_depth_) {
       int f = bc.first;
-      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      int c = cells[0];
+      int c = recs[i++].c;
 
       markers[f] = Operators::OPERATOR_BC_NEUMANN;
       values[f] = std::sqrt(gz) * std::pow(h_c[0][c], 1.5) * nliq_c[0][c];
@@ -893,10 +895,11 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
     const Epetra_MultiVector& h_c = *S->GetFieldData(pd_key_)->ViewComponent("cell");
     const Epetra_MultiVector& elevation_c = *S->GetFieldData(elev_key_)->ViewComponent("cell");
 
+    const auto& recs = bc_plan_->Records(*bc_seepage_head_);
+    int i = 0;
     for (const auto& bc : *bc_seepage_head_) {
       int f = bc.first;
-      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      int c = cells[0];
+      int c = recs[i++].c;
 
       double hz_f = bc.second + elevation[0][f];
       double hz_c = h_c[0][c] + elevation_c[0][c];
@@ -926,10 +929,11 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
       const Epetra_MultiVector& eta = *S->GetFieldData(Keys::getKey(domain_,"unfrozen_fraction"))->ViewComponent("cell");
       const Epetra_MultiVector& rho_i = *S->GetFieldData(Keys::getKey(domain_,"mass_density_ice"))->ViewComponent("cell");
 
+      const auto& recs = bc_plan_->Records(*bc_seepage_pressure_);
+      int i = 0;
       for (const auto& bc : *bc_seepage_pressure_) {
         int f = bc.first;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-        int c = cells[0];
+        int c = recs[i++].c;
 
         double p0 = bc.second > p_atm ? bc.second : p_atm;
         double h0 = (p0 - p_atm) / ((eta[0][c]*rho_l[0][c] + (1.-eta[0][c])*rho_i[0][c]) * gz);
@@ -946,10 +950,11 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
 
     } else {
       // non-thermal model
+      const auto& recs = bc_plan_->Records(*bc_seepage_pressure_);
+      int i = 0;
       for (const auto& bc : *bc_seepage_pressure_) {
         int f = bc.first;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-        int c = cells[0];
+        int c = recs[i++].c;
 
         double p0 = bc.second > p_atm ? bc.second : p_atm;
         double h0 = (p0 - p_atm) / (rho_l[0][c] * gz);
@@ -987,23 +992,9 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
 
     for (const auto& bc : *bc_tidal_) {
       int f = bc.first;
-
-      AmanziMesh::Entity_ID_List cells, faces;
-      std::vector<int> fdirs;
-      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
-      AmanziMesh::Entity_ID c = cells[0];
+      AMANZI_ASSERT(bc_plan_->IsBoundary(f));
 
       if (f < nfaces_owned) {
-        mesh_->cell_get_faces_and_dirs(c, &faces, &fdirs);
-        int j=0;
-        for (j=0; j<faces.size(); j++){
-          if (faces[j] == f) break;
-        }
-        if (j >= faces.size()) {
-          Errors::Message message("Overland_pressure PK: boundary face is not found in the boundary cell.");
-          Exceptions::amanzi_throw(message);
-        }
         double h0 = bc.second;
 
         if ((h0 - elevation_f[0][f]  < min_tidal_bc_ponded_depth_) ) {
@@ -1025,17 +1016,16 @@ void OverlandPressureFlow::UpdateBoundaryConditions_(const Teuchos::Ptr<State>&
   // conditions as the default, zero flux conditions
   int nfaces_owned = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
   for (int f = 0; f != nfaces_owned; ++f) {
-    mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    int ncells = cells.size();
-
-    if ((markers[f] != Operators::OPERATOR_BC_NONE) && (ncells == 2)) {
+    if ((markers[f] != Operators::OPERATOR_BC_NONE) && !bc_plan_->IsBoundary(f)) {
       Errors::Message msg("Tried to set a boundary condition on internal face GID ");
       msg << mesh_->face_map(false).GID(f);
       Exceptions::amanzi_throw(msg);
     }
-    if ((markers[f] == Operators::OPERATOR_BC_NONE) && (ncells == 1)) {
-        markers[f] = Operators::OPERATOR_BC_NEUMANN;
-        values[f] = 0.0;
+  }
+  for (const auto& rec : bc_plan_->OwnedRecords()) {
+    if (markers[rec.f] == Operators::OPERATOR_BC_NONE) {
+      markers[rec.f] = Operators::OPERATOR_BC_NEUMANN;
+      values[rec.f] = 0.0;
     }
   }
 }
@@ -1078,9 +1068,7 @@ OverlandPressureFlow::ApplyBoundaryConditions_(const Teuchos::Ptr<CompositeVecto
         //  this simply makes the upwinded conductivities make more sense, and
         //  changes no answers as boundary faces and their resulting
         //  conductivity are not used in Neumann conditions.
-        AmanziMesh::Entity_ID_List cells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-        u_bf[0][bf] = u_c[0][cells[0]];
+        u_bf[0][bf] = u_c[0][bc_plan_->Record(f).c];
       }
     }
   }
@@ -1119,13 +1107,11 @@ void OverlandPressureFlow::FixBCsForOperator_(const Teuchos::Ptr<State>& S,
 
     int ncells_owned = mesh_->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
     int nfaces_owned = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+    const auto& recs = bc_plan_->Records(*bc_zero_gradient_);
+    int i = 0;
     for (const auto& bc : *bc_zero_gradient_) {
       int f = bc.first;
-
-      AmanziMesh::Entity_ID_List cells;
-      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
-      AmanziMesh::Entity_ID c = cells[0];
+      AmanziMesh::Entity_ID c = recs[i++].c;
 
       if (f < nfaces_owned) {
         double dp = elevation_f[0][f] - elevation_c[0][c];
@@ -1149,25 +1135,13 @@ void OverlandPressureFlow::FixBCsForOperator_(const Teuchos::Ptr<State>& S,
     double gz = -(*S->GetConstantVectorData("gravity"))[2];
     int nfaces_owned = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
 
+    const auto& recs = bc_plan_->Records(*bc_tidal_);
+    int i = 0;
     for (const auto& bc : *bc_tidal_) {
       int f = bc.first;
-
-      AmanziMesh::Entity_ID_List cells, faces;
-      std::vector<int> fdirs;
-      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
-      AmanziMesh::Entity_ID c = cells[0];
+      AmanziMesh::Entity_ID c = recs[i++].c;
 
       if (f < nfaces_owned) {
-        mesh_->cell_get_faces_and_dirs(c, &faces, &fdirs);
-        int j=0;
-        for (j=0; j<faces.size(); j++) {
-          if (faces[j] == f) break;
-        }
-        if (j >= faces.size()) {
-          Errors::Message msg("Overland_pressure PK: boundary face is not found in the boundary cell.");
-          Exceptions::amanzi_throw(msg);
-        }
         double h0 = bc.second;
 
         if ((h0 - elevation_f[0][f] < min_tidal_bc_ponded_depth_)) {
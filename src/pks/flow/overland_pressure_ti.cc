@@ -53,33 +53,35 @@ void OverlandPressureFlow::FunctionalResidual( double t_old,
   S_next_->GetFieldEvaluator(potential_key_)->HasFieldChanged(S_next_.ptr(), name_);
 
   // dump u_old, u_new
-  db_->WriteCellInfo(true);
-  std::vector<std::string> vnames;
-  vnames.push_back("p_old");
-  vnames.push_back("p_new");
-  vnames.push_back("z");
-  vnames.push_back("h_old");
-  vnames.push_back("h_new");
-  vnames.push_back("h+z");
-  if (plist_->get<bool>("subgrid model", false)) {
-    vnames.push_back("pd - dd");
-    vnames.push_back("frac_cond");
-  }
+  if (db_gate_->Collect()) {
+    db_->WriteCellInfo(true);
+    std::vector<std::string> vnames;
+    vnames.push_back("p_old");
+    vnames.push_back("p_new");
+    vnames.push_back("z");
+    vnames.push_back("h_old");
+    vnames.push_back("h_new");
+    vnames.push_back("h+z");
+    if (plist_->get<bool>("subgrid model", false)) {
+      vnames.push_back("pd - dd");
+      vnames.push_back("frac_cond");
+    }
 
-  std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
-  vecs.push_back(S_inter_->GetFieldData(key_).ptr());
-  vecs.push_back(u.ptr());
+    std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
+    vecs.push_back(S_inter_->GetFieldData(key_).ptr());
+    vecs.push_back(u.ptr());
 
-  vecs.push_back(S_inter_->GetFieldData(elev_key_).ptr());
-  vecs.push_back(S_inter_->GetFieldData(pd_key_).ptr());
-  vecs.push_back(S_next_->GetFieldData(pd_key_).ptr());
-  vecs.push_back(S_next_->GetFieldData(potential_key_).ptr());
+    vecs.push_back(S_inter_->GetFieldData(elev_key_).ptr());
+    vecs.push_back(S_inter_->GetFieldData(pd_key_).ptr());
+    vecs.push_back(S_next_->GetFieldData(pd_key_).ptr());
+    vecs.push_back(S_next_->GetFieldData(potential_key_).ptr());
 
-  if (plist_->get<bool>("subgrid model", false)) {
-    vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"ponded_depth_minus_depression_depth")).ptr());
-    vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"fractional_conductance")).ptr());
+    if (plist_->get<bool>("subgrid model", false)) {
+      vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"ponded_depth_minus_depression_depth")).ptr());
+      vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"fractional_conductance")).ptr());
+    }
+    db_->WriteVectors(vnames, vecs, true);
   }
-  db_->WriteVectors(vnames, vecs, true);
 
   // update boundary conditions
   bc_head_->Compute(S_next_->time());
@@ -98,29 +100,31 @@ void OverlandPressureFlow::FunctionalResidual( double t_old,
   // diffusion term, treated implicitly
   ApplyDiffusion_(S_next_.ptr(), res.ptr());
 
-  db_->WriteBoundaryConditions(bc_markers(), bc_values());
-  if (S_next_->HasField(Keys::getKey(domain_,"unfrozen_fraction"))) {
-    vnames.resize(2);
-    vecs.resize(2);
-    vnames[0] = "uf_frac_old";
-    vnames[1] = "uf_frac_new";
-    vecs[0] = S_inter_->GetFieldData(Keys::getKey(domain_,"unfrozen_fraction")).ptr();
-    vecs[1] = S_next_->GetFieldData(Keys::getKey(domain_,"unfrozen_fraction")).ptr();
-    db_->WriteVectors(vnames, vecs, true);
+  if (db_gate_->Collect()) {
+    db_->WriteBoundaryConditions(bc_markers(), bc_values());
+    if (S_next_->HasField(Keys::getKey(domain_,"unfrozen_fraction"))) {
+      std::vector<std::string> vnames;
+      vnames.push_back("uf_frac_old");
+      vnames.push_back("uf_frac_new");
+      std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
+      vecs.push_back(S_inter_->GetFieldData(Keys::getKey(domain_,"unfrozen_fraction")).ptr());
+      vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"unfrozen_fraction")).ptr());
+      db_->WriteVectors(vnames, vecs, true);
+    }
+    db_->WriteVector("uw_dir", S_next_->GetFieldData(flux_dir_key_).ptr(), true);
+    db_->WriteVector("k_s", S_next_->GetFieldData(cond_key_).ptr(), true);
+    db_->WriteVector("k_s_uw", S_next_->GetFieldData(uw_cond_key_).ptr(), true);
+    db_->WriteVector("q_s", S_next_->GetFieldData(flux_key_).ptr(), true);
+    db_->WriteVector("res (diff)", res.ptr(), true);
   }
-  db_->WriteVector("uw_dir", S_next_->GetFieldData(flux_dir_key_).ptr(), true);
-  db_->WriteVector("k_s", S_next_->GetFieldData(cond_key_).ptr(), true);
-  db_->WriteVector("k_s_uw", S_next_->GetFieldData(uw_cond_key_).ptr(), true);
-  db_->WriteVector("q_s", S_next_->GetFieldData(flux_key_).ptr(), true);
-  db_->WriteVector("res (diff)", res.ptr(), true);
 
   // accumulation term
   AddAccumulation_(res.ptr());
-  db_->WriteVector("res (acc)", res.ptr(), true);
+  if (db_gate_->Collect()) db_->WriteVector("res (acc)", res.ptr(), true);
 
   // add rhs load value
   AddSourceTerms_(res.ptr());
-  db_->WriteVector("res (src)", res.ptr(), true);
+  if (db_gate_->Collect()) db_->WriteVector("res (src)", res.ptr(), true);
 
 #if DEBUG_RES_FLAG
   if (niter_ < 23) {
@@ -253,9 +257,9 @@ void OverlandPressureFlow::UpdatePreconditioner(double t,
   db_->WriteVector("    dwc_dp", dwc_dp.ptr());
   db_->WriteVector("    dh_dp", dh_dp.ptr());
 
-  CompositeVector dwc_dh(dwc_dp->Map());
-  dwc_dh.ReciprocalMultiply(1./h, *dh_dp, *dwc_dp, 0.);
-  preconditioner_acc_->AddAccumulationTerm(dwc_dh, "cell");
+  Teuchos::RCP<CompositeVector> dwc_dh = workspace_.Get("dwc_dh", dwc_dp->Map());
+  dwc_dh->ReciprocalMultiply(1./h, *dh_dp, *dwc_dp, 0.);
+  preconditioner_acc_->AddAccumulationTerm(*dwc_dh, "cell");
 
   // Why is this turned off? #60 --etc
   // // -- update the source term derivatives
@@ -122,6 +122,11 @@ Solves Richards equation:
       ``[double]`` **-1** If > 0, this limits an iterate's max pressure change
       to this value when they cross atmospheric pressure.  Not usually helpful.
 
+    * `"preconditioner reuse`" ``[preconditioner-reuse-spec]`` **optional**
+      Keep the assembled preconditioner across iterations and timesteps.  Only
+      set this when Richards is not strongly coupled to other PKs.  See
+      PreconditionerReuse_.
+
     INCLUDES:
 
     - ``[pk-physical-bdf-default-spec]`` A `PK: Physical and BDF`_ spec.
@@ -210,11 +215,13 @@ Solves Richards equation:
 #include "wrm_partition.hh"
 #include "BoundaryFunction.hh"
 #include "upwinding.hh"
+#include "boundary_face_plan.hh"
 
 #include "PDE_DiffusionFactory.hh"
 #include "PDE_Accumulation.hh"
 #include "PK_Factory.hh"
 #include "pk_physical_bdf_default.hh"
+#include "preconditioner_reuse.hh"
 
 namespace Amanzi {
 
@@ -266,6 +273,10 @@ public:
   // updates the preconditioner
   virtual void UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h);
 
+  // error norm, also monitored for preconditioner reuse
+  virtual double ErrorNorm(Teuchos::RCP<const TreeVector> u,
+                           Teuchos::RCP<const TreeVector> du);
+
   virtual bool ModifyPredictor(double h, Teuchos::RCP<const TreeVector> u0,
           Teuchos::RCP<TreeVector> u);
 
@@ -372,6 +383,7 @@ protected:
   int iter_;
   double iter_counter_time_;
   int jacobian_lag_;
+  PreconditionerReuse precon_reuse_;
 
   // residual vector for vapor diffusion
   Teuchos::RCP<CompositeVector> res_vapor;
@@ -385,6 +397,7 @@ protected:
   Teuchos::RCP<Functions::BoundaryFunction> bc_seepage_;
   Teuchos::RCP<Functions::BoundaryFunction> bc_seepage_infilt_;
   Teuchos::RCP<Functions::BoundaryFunction> bc_infiltration_;
+  Teuchos::RCP<BoundaryFacePlan> bc_plan_;
   double bc_rho_water_;
 
   // delegates
@@ -128,6 +128,7 @@ void Richards::SetupRichardsFlow_(const Teuchos::Ptr<State>& S)
   bc_seepage_infilt_ = bc_factory.CreateSeepageFacePressureWithInfiltration();
   bc_seepage_infilt_->Compute(0.); // compute at t=0 to set up
   bc_rho_water_ = bc_plist.get<double>("hydrostatic water density [kg m^-3]",1000.);
+  bc_plan_ = Teuchos::rcp(new BoundaryFacePlan(mesh_));
 
   // scaling for permeability
   perm_scale_ = plist_->get<double>("permeability rescaling", 1.e7);
@@ -290,6 +291,11 @@ void Richards::SetupRichardsFlow_(const Teuchos::Ptr<State>& S)
   acc_pc_plist.set<std::string>("entity kind", "cell");
   preconditioner_acc_ = Teuchos::rcp(new Operators::PDE_Accumulation(acc_pc_plist, preconditioner_));
 
+  // -- policy for reusing the assembled preconditioner
+  if (plist_->isSublist("preconditioner reuse")) {
+    precon_reuse_ = PreconditionerReuse(plist_->sublist("preconditioner reuse"));
+  }
+
   // // -- vapor diffusion terms
   // vapor_diffusion_ = plist_->get<bool>("include vapor diffusion", false);
   // if (vapor_diffusion_){
@@ -676,6 +682,9 @@ void Richards::CommitStep(double t_old, double t_new, const Teuchos::RCP<State>&
 
   PK_PhysicalBDF_Default::CommitStep(t_old, t_new, S);
 
+  if (precon_reuse_.enabled() && vo_->os_OK(Teuchos::VERB_HIGH))
+    precon_reuse_.WriteStatistics(*vo_->os());
+
   // update BCs, rel perm
   UpdateBoundaryConditions_(S.ptr());
   bool update = UpdatePermeabilityData_(S.ptr());
@@ -852,16 +861,7 @@ bool Richards::UpdatePermeabilityData_(const Teuchos::Ptr<State>& S)
 
         for (int f=0; f!=markers.size(); ++f) {
           if (markers[f] == Operators::OPERATOR_BC_NEUMANN) {
-            AmanziMesh::Entity_ID_List cells;
-            mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-            AMANZI_ASSERT(cells.size() == 1);
-            int c = cells[0];
-            AmanziMesh::Entity_ID_List faces;
-            std::vector<int> dirs;
-            mesh_->cell_get_faces_and_dirs(c, &faces, &dirs);
-            int i = std::find(faces.begin(), faces.end(), f) - faces.begin();
-
-            flux_dir_f[0][f] = values[f]*dirs[i];
+            flux_dir_f[0][f] = values[f]*bc_plan_->Record(f).dir;
           }
         }
       }
@@ -906,13 +906,11 @@ bool Richards::UpdatePermeabilityData_(const Teuchos::Ptr<State>& S)
       const auto& bfmap = mesh_->exterior_face_map(true);
       for (int bf=0; bf!=rel_perm_bf.MyLength(); ++bf) {
         auto f = fmap.LID(bfmap.GID(bf));
-        AmanziMesh::Entity_ID_List fcells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &fcells);
-        AMANZI_ASSERT(fcells.size() == 1);
-        if (pres[0][fcells[0]] < 101225.) {
+        auto c = bc_plan_->Record(f).c;
+        if (pres[0][c] < 101225.) {
           uw_rel_perm_f[0][f] = rel_perm_bf[0][bf];
-        } else if (pres[0][fcells[0]] < 101325.) {
-          double frac = (101325. - pres[0][fcells[0]])/100.;
+        } else if (pres[0][c] < 101325.) {
+          double frac = (101325. - pres[0][c])/100.;
           uw_rel_perm_f[0][f] = rel_perm_bf[0][bf] * frac + uw_rel_perm_f[0][f] * (1-frac);
         }
       }
@@ -1021,17 +1019,16 @@ void Richards::UpdateBoundaryConditions_(const Teuchos::Ptr<State>& S, bool kr)
     int z_index = mesh_->space_dimension() - 1;
     double g = -(*S->GetConstantVectorData("gravity"))[z_index];
 
+    const auto& recs = bc_plan_->Records(*bc_head_);
+    int i = 0;
     for (const auto& bc : *bc_head_) {
       int f = bc.first;
-
-      AmanziMesh::Entity_ID_List cells;
-      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      AMANZI_ASSERT(cells.size() == 1);
+      int c = recs[i++].c;
 
       // we need to find the elevation of the surface, but finding the top edge
       // of this stack of faces is not possible currently.  The best approach
       // is instead to work with the cell.
-      int col = mesh_->column_ID(cells[0]);
+      int col = mesh_->column_ID(c);
       double z_surf = mesh_->face_centroid(mesh_->faces_of_column(col)[0])[z_index];
       double z_wt = bc.second + z_surf;
 
@@ -1039,7 +1036,7 @@ void Richards::UpdateBoundaryConditions_(const Teuchos::Ptr<State>& S, bool kr)
       // note, here the cell centroid's z is used to relate to the column's top
       // face centroid, specifically NOT the boundary face's centroid.
       values[f] = p_atm + bc_rho_water_ * g *
-        (z_wt - mesh_->cell_centroid(cells[0])[z_index]);
+        (z_wt - mesh_->cell_centroid(c)[z_index]);
     }
   }
 
@@ -1111,16 +1108,14 @@ void Richards::UpdateBoundaryConditions_(const Teuchos::Ptr<State>& S, bool kr)
 
   bc_counts.push_back(bc_seepage_->size());
   bc_names.push_back("standard seepage");
+  const auto& seepage_recs = bc_plan_->Records(*bc_seepage_);
+  int i_seepage = 0;
   for (const auto& bc : *bc_seepage_) {
     int f = bc.first;
-#ifdef ENABLE_DBC
-    AmanziMesh::Entity_ID_List cells;
-    mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    AMANZI_ASSERT(cells.size() == 1);
-#endif
+    const BoundaryFaceRecord& rec = seepage_recs[i_seepage++];
 
-    double boundary_pressure = getFaceOnBoundaryValue(f, *u, *bc_);
-    double boundary_flux = flux[0][f]*getBoundaryDirection(*mesh_, f);
+    double boundary_pressure = getFaceOnBoundaryValue(f, rec.c, *u, *bc_);
+    double boundary_flux = flux[0][f]*rec.dir;
     if (boundary_pressure > bc.second) {
       markers[f] = Operators::OPERATOR_BC_DIRICHLET;
       values[f] = bc.second;
@@ -1139,17 +1134,15 @@ void Richards::UpdateBoundaryConditions_(const Teuchos::Ptr<State>& S, bool kr)
   // seepage face -- pressure <= p_atm, outward mass flux is specified
   bc_counts.push_back(bc_seepage_infilt_->size());
   bc_names.push_back("seepage with infiltration");
+  const auto& infilt_recs = bc_plan_->Records(*bc_seepage_infilt_);
+  int i_infilt = 0;
   for (const auto& bc : *bc_seepage_infilt_) {
     int f = bc.first;
-#ifdef ENABLE_DBC
-    AmanziMesh::Entity_ID_List cells;
-    mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-    AMANZI_ASSERT(cells.size() == 1);
-#endif
+    const BoundaryFaceRecord& rec = infilt_recs[i_infilt++];
 
     double flux_seepage_tol = std::abs(bc.second) * .001;
-    double boundary_pressure = getFaceOnBoundaryValue(f, *u, *bc_);
-    double boundary_flux = flux[0][f]*getBoundaryDirection(*mesh_, f);
+    double boundary_pressure = getFaceOnBoundaryValue(f, rec.c, *u, *bc_);
+    double boundary_flux = flux[0][f]*rec.dir;
     //    std::cout << "BFlux = " << boundary_flux << " with constraint = " << bc.second - flux_seepage_tol << std::endl;
 
     if (boundary_flux < bc.second - flux_seepage_tol &&
@@ -1243,19 +1236,12 @@ void Richards::UpdateBoundaryConditions_(const Teuchos::Ptr<State>& S, bool kr)
   }
 
   // mark all remaining boundary conditions as zero flux conditions
-  AmanziMesh::Entity_ID_List cells;
   int n_default = 0;
-  int nfaces_owned = mesh_->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
-  for (int f = 0; f < nfaces_owned; f++) {
-    if (markers[f] == Operators::OPERATOR_BC_NONE) {
-      mesh_->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
-      int ncells = cells.size();
-
-      if (ncells == 1) {
-        n_default++;
-        markers[f] = Operators::OPERATOR_BC_NEUMANN;
-        values[f] = 0.0;
-      }
+  for (const auto& rec : bc_plan_->OwnedRecords()) {
+    if (markers[rec.f] == Operators::OPERATOR_BC_NONE) {
+      n_default++;
+      markers[rec.f] = Operators::OPERATOR_BC_NEUMANN;
+      values[rec.f] = 0.0;
     }
   }
   bc_names.push_back("default (zero flux)");
@@ -45,17 +45,19 @@ void Richards::FunctionalResidual(double t_old,
                << " t1 = " << t_new << " h = " << h << std::endl;
 
   // dump u_old, u_new
-  db_->WriteCellInfo(true);
-  std::vector<std::string> vnames;
-  vnames.push_back("p_old"); vnames.push_back("p_new");
-  std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
-  vecs.push_back(S_inter_->GetFieldData(key_).ptr()); vecs.push_back(u.ptr());
-  db_->WriteVectors(vnames, vecs, true);
+  if (db_gate_->Collect()) {
+    db_->WriteCellInfo(true);
+    std::vector<std::string> vnames;
+    vnames.push_back("p_old"); vnames.push_back("p_new");
+    std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
+    vecs.push_back(S_inter_->GetFieldData(key_).ptr()); vecs.push_back(u.ptr());
+    db_->WriteVectors(vnames, vecs, true);
+  }
 
   // update boundary conditions
   ComputeBoundaryConditions_(S_next_.ptr());
   UpdateBoundaryConditions_(S_next_.ptr());
-  db_->WriteBoundaryConditions(bc_markers(), bc_values());
+  if (db_gate_->Collect()) db_->WriteBoundaryConditions(bc_markers(), bc_values());
 
   // zero out residual
   Teuchos::RCP<CompositeVector> res = g->Data();
@@ -66,31 +68,35 @@ void Richards::FunctionalResidual(double t_old,
   // if (vapor_diffusion_) AddVaporDiffusionResidual_(S_next_.ptr(), res.ptr());
 
   // dump s_old, s_new
-  vnames[0] = "sl_old"; vnames[1] = "sl_new";
-  vecs[0] = S_inter_->GetFieldData(sat_key_).ptr();
-  vecs[1] = S_next_->GetFieldData(sat_key_).ptr();
-
-  if (S_next_->HasField(sat_ice_key_)) {
-    vnames.push_back("si_old");
-    vnames.push_back("si_new");
-    vecs.push_back(S_inter_->GetFieldData(Keys::getKey(domain_,"saturation_ice")).ptr());
-    vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"saturation_ice")).ptr());
+  if (db_gate_->Collect()) {
+    std::vector<std::string> vnames;
+    std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
+    vnames.push_back("sl_old"); vnames.push_back("sl_new");
+    vecs.push_back(S_inter_->GetFieldData(sat_key_).ptr());
+    vecs.push_back(S_next_->GetFieldData(sat_key_).ptr());
+
+    if (S_next_->HasField(sat_ice_key_)) {
+      vnames.push_back("si_old");
+      vnames.push_back("si_new");
+      vecs.push_back(S_inter_->GetFieldData(Keys::getKey(domain_,"saturation_ice")).ptr());
+      vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"saturation_ice")).ptr());
+    }
+    vnames.push_back("poro");
+    vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"porosity")).ptr());
+    vnames.push_back("perm_K");
+    vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"permeability")).ptr());
+    vnames.push_back("k_rel");
+    vecs.push_back(S_next_->GetFieldData(coef_key_).ptr());
+    vnames.push_back("wind");
+    vecs.push_back(S_next_->GetFieldData(flux_dir_key_).ptr());
+    vnames.push_back("uw_k_rel");
+    vecs.push_back(S_next_->GetFieldData(uw_coef_key_).ptr());
+    vnames.push_back("flux");
+    vecs.push_back(S_next_->GetFieldData(flux_key_).ptr());
+    db_->WriteVectors(vnames,vecs,true);
+
+    db_->WriteVector("res (diff)", res.ptr(), true);
   }
-  vnames.push_back("poro");
-  vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"porosity")).ptr());
-  vnames.push_back("perm_K");
-  vecs.push_back(S_next_->GetFieldData(Keys::getKey(domain_,"permeability")).ptr());
-  vnames.push_back("k_rel");
-  vecs.push_back(S_next_->GetFieldData(coef_key_).ptr());
-  vnames.push_back("wind");
-  vecs.push_back(S_next_->GetFieldData(flux_dir_key_).ptr());
-  vnames.push_back("uw_k_rel");
-  vecs.push_back(S_next_->GetFieldData(uw_coef_key_).ptr());
-  vnames.push_back("flux");
-  vecs.push_back(S_next_->GetFieldData(flux_key_).ptr());
-  db_->WriteVectors(vnames,vecs,true);
-
-  db_->WriteVector("res (diff)", res.ptr(), true);
 
   // accumulation term
   AddAccumulation_(res.ptr());
@@ -124,6 +130,17 @@ int Richards::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP
 };
 
 
+// -----------------------------------------------------------------------------
+// Error norm, recording the nonlinear contraction for preconditioner reuse.
+// -----------------------------------------------------------------------------
+double Richards::ErrorNorm(Teuchos::RCP<const TreeVector> u,
+                           Teuchos::RCP<const TreeVector> du) {
+  double enorm = PK_PhysicalBDF_Default::ErrorNorm(u, du);
+  precon_reuse_.RecordErrorNorm(S_next_->time(), enorm);
+  return enorm;
+};
+
+
 // -----------------------------------------------------------------------------
 // Update the preconditioner at time t and u = up
 // -----------------------------------------------------------------------------
@@ -137,6 +154,7 @@ void Richards::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
   if (dynamic_mesh_) {
     matrix_diff_->SetTensorCoefficient(K_);
     preconditioner_diff_->SetTensorCoefficient(K_);
+    precon_reuse_.Invalidate();
   }
 
   // update state with the solution up.
@@ -144,12 +162,23 @@ void Richards::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
     iter_ = 0;
     iter_counter_time_ = t;
   }
+
+  // keep the last assembled preconditioner if it is still good enough.  The
+  // iteration count advances either way, so that the Newton correction lag
+  // counts updates whether or not they rebuild.
+  bool newton = jacobian_ && iter_ >= jacobian_lag_;
+  if (!precon_reuse_.Rebuild(h, newton)) {
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "  reusing preconditioner" << std::endl;
+    iter_++;
+    return;
+  }
   AMANZI_ASSERT(std::abs(S_next_->time() - t) <= 1.e-4*t);
   PK_PhysicalBDF_Default::Solution_to_State(*up, S_next_);
 
   // update the rel perm according to the scheme of choice, also upwind derivatives of rel perm
   UpdatePermeabilityData_(S_next_.ptr());
-  if (jacobian_ && iter_ >= jacobian_lag_) UpdatePermeabilityDerivativeData_(S_next_.ptr());
+  if (newton) UpdatePermeabilityDerivativeData_(S_next_.ptr());
 
   // update boundary conditions
   ComputeBoundaryConditions_(S_next_.ptr());
@@ -168,7 +197,7 @@ void Richards::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
 
   // jacobian term
   Teuchos::RCP<const CompositeVector> dkrdp = Teuchos::null;
-  if (jacobian_ && iter_ >= jacobian_lag_) {
+  if (newton) {
     if (!duw_coef_key_.empty()) {
       dkrdp = S_next_->GetFieldData(duw_coef_key_);
     } else {
@@ -181,7 +210,7 @@ void Richards::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up,
   preconditioner_diff_->UpdateMatrices(Teuchos::null, up->Data().ptr());
   preconditioner_diff_->ApplyBCs(true, true, true);
 
-  if (jacobian_ && iter_ >= jacobian_lag_) {// && preconditioner_->RangeMap().HasComponent("face")) {
+  if (newton) {// && preconditioner_->RangeMap().HasComponent("face")) {
     Teuchos::RCP<CompositeVector> flux = S_next_->GetFieldData(flux_key_, name_);
     preconditioner_diff_->UpdateFlux(up->Data().ptr(), flux.ptr());
     preconditioner_diff_->UpdateMatricesNewtonCorrection(flux.ptr(), up->Data().ptr());
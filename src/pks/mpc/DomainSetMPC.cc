@@ -9,6 +9,12 @@ A DomainSet coupler, couples a bunch of domains of the same structure.
 
 ------------------------------------------------------------------------- */
 
+#include <algorithm>
+#include <numeric>
+
+#include "Teuchos_Time.hpp"
+
+#include "subcycle.hh"
 #include "DomainSetMPC.hh"
 
 namespace Amanzi {
@@ -34,12 +40,17 @@ DomainSetMPC::DomainSetMPC(Teuchos::ParameterList& pk_tree,
   }
 
   // add for the various sub-pks based on IDs
+  subdomains_.resize(subpks.size());
   auto ds = S->GetDomainSet(std::get<0>(triple));
   for (auto& name_id : *ds) {
     subpks.push_back(Keys::getKey(name_id.first, std::get<2>(triple)));
+    subdomains_.push_back(name_id.first);
   }
   this->plist_->template set("PKs order", subpks);
 
+  subcycle_failed_ = this->plist_->template get<bool>("subcycle failed subdomains", false);
+  subcycle_min_dt_ = this->plist_->template get<double>("subcycling minimum timestep [s]", 1.e-4);
+
   // construct the sub-PKs on COMM_SELF
   MPC<PK>::init_(S, getCommSelf());
 }
@@ -73,20 +84,150 @@ void DomainSetMPC::set_dt( double dt) {
 // Semi coupled thermal hydrology
 bool 
 DomainSetMPC::AdvanceStep(double t_old, double t_new, bool reinit) {
+  int npks = sub_pks_.size();
+  if (subcycle_failed_ && S_inter_ == S_) {
+    Errors::Message msg;
+    msg << "DomainSetMPC \"" << name() << "\": \"subcycle failed subdomains\" requires"
+        << " the cycle driver option \"support subcycling\", so that the"
+        << " intermediate state is separate from the committed state.";
+    Exceptions::amanzi_throw(msg);
+  }
+
+  // schedule using last step's costs, then clear them
+  Schedule_();
+  subcycled_.assign(npks, false);
+  wall_times_.assign(npks, 0.);
+
   int nfailed = 0;
-  for (const auto& pk : sub_pks_) {
-    bool fail = pk->AdvanceStep(t_old, t_new, reinit);
+  for (int i : schedule_) {
+    Teuchos::Time pk_timer("subdomain", true);
+    bool fail = sub_pks_[i]->AdvanceStep(t_old, t_new, reinit);
+
+    // isolate the failure to this subdomain, trying again with its own dt
+    if (fail && subcycle_failed_ && !subdomains_[i].empty()) {
+      S_next_->AssignDomain(*S_inter_, subdomains_[i]);
+      subcycled_[i] = true;
+      fail = SubcycleSubdomain_(i, t_old, t_new);
+    }
+    wall_times_[i] = pk_timer.totalElapsedTime();
+
     if (fail) {
       nfailed++;
       break;
     }
   }
 
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) ReportSubdomainTimings_();
+
   int nfailed_global(0);
   solution_->Comm()->SumAll(&nfailed, &nfailed_global, 1);
   if (nfailed_global) return true;
   return false;
 }
-  
+
+
+// -----------------------------------------------------------------------------
+// Subcycled subdomains have already committed their substeps.
+// -----------------------------------------------------------------------------
+void DomainSetMPC::CommitStep(double t_old, double t_new, const Teuchos::RCP<State>& S) {
+  for (int i=0; i!=sub_pks_.size(); ++i) {
+    if (i < subcycled_.size() && subcycled_[i]) continue;
+    sub_pks_[i]->CommitStep(t_old, t_new, S);
+  }
+}
+
+
+// -----------------------------------------------------------------------------
+// Subcycle one subdomain from t_old to t_new using the PK's own dt, assigning
+// only that subdomain's data between S_inter_ and S_next_.  Returns true if
+// the subdomain's timestep crashes.
+// -----------------------------------------------------------------------------
+bool DomainSetMPC::SubcycleSubdomain_(int i, double t_old, double t_new) {
+  Teuchos::OSTab tab = vo_->getOSTab();
+  const auto& subdomain = subdomains_[i];
+  if (vo_->os_OK(Teuchos::VERB_HIGH))
+    *vo_->os() << "Subdomain " << subdomain << " failed, subcycling" << std::endl;
+
+  auto prepare = [&](double t0, double t1) {
+    // both states must be at the substep's times, as the PK takes its
+    // timestep from S_next_->time() - S_inter_->time()
+    *S_next_->GetScalarData("dt", "coordinator") = t1 - t0;
+    S_inter_->set_time(t0);
+    S_next_->set_time(t1);
+  };
+  auto advance = [&](double t0, double t1) {
+    bool fail = sub_pks_[i]->AdvanceStep(t0, t1, false);
+    return fail || !sub_pks_[i]->ValidStep();
+  };
+  auto commit = [&](double t0, double t1) {
+    sub_pks_[i]->CommitStep(t0, t1, S_next_);
+    S_inter_->AssignDomain(*S_next_, subdomain);
+    if (vo_->os_OK(Teuchos::VERB_EXTREME))
+      *vo_->os() << "  " << subdomain << " substep succeeded, new timestep is "
+                 << sub_pks_[i]->get_dt() << std::endl;
+  };
+  auto rollback = [&](double, double) {
+    S_next_->AssignDomain(*S_inter_, subdomain);
+    if (vo_->os_OK(Teuchos::VERB_EXTREME))
+      *vo_->os() << "  " << subdomain << " substep failed, new timestep is "
+                 << sub_pks_[i]->get_dt() << std::endl;
+  };
+  auto get_dt = [&]() { return sub_pks_[i]->get_dt(); };
+  bool fail = Subcycle(t_old, t_new, subcycle_min_dt_, prepare, advance, commit, rollback, get_dt);
+
+  // restore the shared times
+  *S_next_->GetScalarData("dt", "coordinator") = t_new - t_old;
+  S_next_->set_time(t_new);
+  S_inter_->set_time(t_old);
+  return fail;
+}
+
+
+// -----------------------------------------------------------------------------
+// Order the sub-PKs for this step.  Non-domain-set PKs keep their place at
+// the front; subdomains follow, longest first by their wall time in the
+// previous step.  The stiffest subdomains are usually the ones that fail,
+// so a failing step is found before the cheap subdomains are computed.
+// -----------------------------------------------------------------------------
+void DomainSetMPC::Schedule_() {
+  if (schedule_.size() != sub_pks_.size()) {
+    schedule_.resize(sub_pks_.size());
+    std::iota(schedule_.begin(), schedule_.end(), 0);
+  }
+
+  // a failed step times only the subdomains it reached, so keep the order
+  if (wall_times_.size() != sub_pks_.size() ||
+      std::any_of(wall_times_.begin(), wall_times_.end(),
+                  [](double t) { return t == 0.; })) return;
+
+  auto first = std::find_if(schedule_.begin(), schedule_.end(),
+                            [this](int i) { return !subdomains_[i].empty(); });
+  std::stable_sort(first, schedule_.end(),
+                   [this](int a, int b) { return wall_times_[a] > wall_times_[b]; });
+}
+
+
+// -----------------------------------------------------------------------------
+// Report the most expensive subdomains on this process.
+// -----------------------------------------------------------------------------
+void DomainSetMPC::ReportSubdomainTimings_() {
+  std::vector<int> order(wall_times_.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [this](int a, int b) { return wall_times_[a] > wall_times_[b]; });
+
+  double total = std::accumulate(wall_times_.begin(), wall_times_.end(), 0.);
+  int nsubcycled = std::count(subcycled_.begin(), subcycled_.end(), true);
+
+  Teuchos::OSTab tab = vo_->getOSTab();
+  *vo_->os() << "Domain set timings: total = " << total << " [s], "
+             << nsubcycled << " subdomains subcycled" << std::endl;
+  for (int j=0; j!=std::min<int>(5, order.size()); ++j) {
+    int i = order[j];
+    *vo_->os() << "  " << sub_pks_[i]->name() << ": " << wall_times_[i] << " [s]"
+               << (subcycled_[i] ? " (subcycled)" : "") << std::endl;
+  }
+}
+
 
 } // namespace Amanzi
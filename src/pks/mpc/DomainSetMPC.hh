@@ -9,7 +9,30 @@
 */
 
 /*!
-  
+
+Advances each PK in a domain set, one at a time.  Subdomain PKs live on
+COMM_SELF, so they are independent of each other within a timestep.
+
+.. _domain-set-weak-mpc-spec:
+.. admonition:: domain-set-weak-mpc-spec
+
+    * `"PKs order`" ``[Array(string)]`` Any non-domain-set PKs, followed by
+      the domain-set PK name, of the form DOMAIN_*-PK_NAME.
+    * `"subcycle failed subdomains`" ``[bool]`` **false** If true, a
+      subdomain PK that fails the step is rolled back and subcycled with its
+      own reduced timestep, rather than failing the step for all subdomains.
+      Subdomains which succeed are not recomputed.  This requires the cycle
+      driver option `"support subcycling`".
+    * `"subcycling minimum timestep [s]`" ``[double]`` **1.e-4** A subdomain
+      whose subcycled timestep falls below this fails the step.
+
+    INCLUDES:
+    - ``[mpc-spec]`` *Is a* MPC_.
+
+Subdomains are advanced longest first, ordered by their wall time in the
+previous step.  At high verbosity, the wall time of the most expensive
+subdomains is reported, which can be used to tune the `"PKs order`".
+
  */
 
 #pragma once
@@ -33,10 +56,26 @@ class DomainSetMPC : public MPC<PK> {
   virtual double get_dt();
   virtual void set_dt(double dt);
   virtual bool AdvanceStep(double t_old, double t_new, bool reinit);
+  virtual void CommitStep(double t_old, double t_new, const Teuchos::RCP<State>& S);
+
+ protected:
+  // -- subcycle subdomain PK i from t_old to t_new, returns true on failure
+  bool SubcycleSubdomain_(int i, double t_old, double t_new);
+  void Schedule_();
+  void ReportSubdomainTimings_();
 
  protected:
   std::string pks_set_;
 
+  // subdomain name of each sub-PK, empty for PKs not in the domain set
+  std::vector<std::string> subdomains_;
+
+  bool subcycle_failed_;
+  double subcycle_min_dt_;
+  std::vector<bool> subcycled_;
+  std::vector<double> wall_times_;
+  std::vector<int> schedule_;
+
  private:
   // factory registration
   static RegisteredPKFactory<DomainSetMPC> reg_;
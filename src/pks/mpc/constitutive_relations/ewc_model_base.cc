@@ -342,6 +342,12 @@ int EWCModelBase::EvaluateEnergyAndWaterContentAndJacobian_(double T, double p,
 }
 
 
+bool EWCModelBase::DegenerateJacobian_(const WhetStone::Tensor& jac) {
+  return (std::abs(jac(0,0)) <= 1.e-12 && std::abs(jac(1,0)) <= 1.e-12) ||
+      (std::abs(jac(0,1)) <= 1.e-12 && std::abs(jac(1,1)) <= 1.e-12);
+}
+
+
 int EWCModelBase::EvaluateEnergyAndWaterContentAndJacobian_FD_(double T, double p,
         AmanziGeometry::Point& result, WhetStone::Tensor& jac) {
   double eps_T = 1.e-7;
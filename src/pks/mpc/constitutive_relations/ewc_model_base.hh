@@ -22,7 +22,7 @@ namespace Amanzi {
 
 class EWCModelBase : public EWCModel {
  public:
-  EWCModelBase() {}
+  EWCModelBase() : fd_jacobian_(false) {}
   virtual ~EWCModelBase() = default;
   
   virtual int Evaluate(double T, double p, double& energy, double& wc);
@@ -39,6 +39,14 @@ class EWCModelBase : public EWCModel {
 
   int EvaluateEnergyAndWaterContentAndJacobian_FD_(double T, double p,
           AmanziGeometry::Point& result, WhetStone::Tensor& jac);
+
+  // Models providing an analytic Jacobian fall back to finite differences
+  // when a column vanishes, as the FD version widens its stencil until it
+  // finds a nonzero derivative.
+  static bool DegenerateJacobian_(const WhetStone::Tensor& jac);
+
+ protected:
+  bool fd_jacobian_;  // force the finite difference Jacobian
 };
 
 } // namespace
@@ -49,6 +49,9 @@ class LiquidIceModel : public EWCModelBase {
   int EvaluateEnergyAndWaterContent_(double T, double p,
           AmanziGeometry::Point& result);
 
+  int EvaluateEnergyAndWaterContentAndJacobian_(double T, double p,
+          AmanziGeometry::Point& result, WhetStone::Tensor& jac);
+
  protected:
   Teuchos::RCP<Flow::WRMPermafrostModelPartition> wrms_;
   Teuchos::RCP<Flow::WRMPermafrostModel> wrm_;
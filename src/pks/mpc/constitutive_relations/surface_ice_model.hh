@@ -52,6 +52,9 @@ class SurfaceIceModel : public EWCModelBase {
   int EvaluateEnergyAndWaterContent_(double T, double p,
           AmanziGeometry::Point& result);
 
+  int EvaluateEnergyAndWaterContentAndJacobian_(double T, double p,
+          AmanziGeometry::Point& result, WhetStone::Tensor& jac);
+
  protected:
   Teuchos::RCP<Flow::IcyHeightModel> pd_;
   Teuchos::RCP<Flow::UnfrozenFractionModel> uf_;
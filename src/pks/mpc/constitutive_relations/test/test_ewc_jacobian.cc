@@ -0,0 +1,207 @@
+#include <algorithm>
+#include <cmath>
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "eos_water.hh"
+#include "eos_ice.hh"
+#include "eos_ideal_gas.hh"
+#include "vapor_pressure_water.hh"
+#include "pc_ice_water.hh"
+#include "pc_liq_atm.hh"
+#include "iem_linear.hh"
+#include "iem_water_vapor.hh"
+#include "compressible_porosity_model.hh"
+#include "wrm_van_genuchten.hh"
+#include "wrm_fpd_permafrost_model.hh"
+#include "icy_height_model.hh"
+#include "unfrozen_fraction_model.hh"
+
+#include "permafrost_model.hh"
+#include "liquid_ice_model.hh"
+#include "surface_ice_model.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+Teuchos::RCP<Energy::IEM> CreateIEM(double Cv, double L, bool molar=true) {
+  Teuchos::ParameterList plist;
+  if (molar) {
+    plist.set<double>("heat capacity [J mol^-1 K^-1]", Cv);
+    plist.set<double>("latent heat [J mol^-1]", L);
+  } else {
+    plist.set<double>("heat capacity [J kg^-1 K^-1]", Cv);
+  }
+  return Teuchos::rcp(new Energy::IEMLinear(plist));
+}
+
+Teuchos::RCP<Flow::WRMPermafrostModel> CreateWRM() {
+  Teuchos::ParameterList vg_plist;
+  vg_plist.set<double>("van Genuchten alpha [Pa^-1]", 1.5e-4);
+  vg_plist.set<double>("van Genuchten m [-]", 0.8);
+  vg_plist.set<double>("residual saturation [-]", 0.1);
+  vg_plist.set<double>("smoothing interval width [saturation]", 0.05);
+
+  Teuchos::ParameterList plist;
+  auto wrm = Teuchos::rcp(new Flow::WRMFPDPermafrostModel(plist));
+  wrm->set_WRM(Teuchos::rcp(new Flow::WRMVanGenuchten(vg_plist)));
+  return wrm;
+}
+
+Teuchos::RCP<Flow::CompressiblePorosityModel> CreatePorosity() {
+  Teuchos::ParameterList plist;
+  plist.set<double>("pore compressibility [Pa^-1]", 1.e-9);
+  return Teuchos::rcp(new Flow::CompressiblePorosityModel(plist));
+}
+
+// Models with their constitutive relations set directly, rather than
+// pulled from the evaluators in State.
+class PermafrostModelTest : public PermafrostModel {
+ public:
+  PermafrostModelTest() {
+    Teuchos::ParameterList plist;
+    wrm_ = CreateWRM();
+    liquid_eos_ = Teuchos::rcp(new Relations::EOSWater(plist));
+    ice_eos_ = Teuchos::rcp(new Relations::EOSIce(plist));
+    gas_eos_ = Teuchos::rcp(new Relations::EOSIdealGas(plist));
+    vpr_ = Teuchos::rcp(new Relations::VaporPressureWater(plist));
+    pc_i_ = Teuchos::rcp(new Flow::PCIceWater(plist));
+    pc_l_ = Teuchos::rcp(new Flow::PCLiqAtm(plist));
+    liquid_iem_ = CreateIEM(76.0, 6000.);
+    ice_iem_ = CreateIEM(37.7, 0.);
+    gas_iem_ = Teuchos::rcp(new Energy::IEMWaterVapor(plist));
+    rock_iem_ = CreateIEM(620.0, 0., false);
+    poro_model_ = CreatePorosity();
+    poro_leij_ = false;
+    p_atm_ = 101325.;
+    poro_ = 0.4;
+    rho_rock_ = 2170.;
+  }
+
+  int Jacobian(double T, double p, AmanziGeometry::Point& res, WhetStone::Tensor& jac) {
+    return EvaluateEnergyAndWaterContentAndJacobian_(T, p, res, jac);
+  }
+};
+
+
+class LiquidIceModelTest : public LiquidIceModel {
+ public:
+  LiquidIceModelTest() {
+    Teuchos::ParameterList plist;
+    wrm_ = CreateWRM();
+    liquid_eos_ = Teuchos::rcp(new Relations::EOSWater(plist));
+    ice_eos_ = Teuchos::rcp(new Relations::EOSIce(plist));
+    gas_eos_ = Teuchos::rcp(new Relations::EOSIdealGas(plist));
+    pc_i_ = Teuchos::rcp(new Flow::PCIceWater(plist));
+    pc_l_ = Teuchos::rcp(new Flow::PCLiqAtm(plist));
+    liquid_iem_ = CreateIEM(76.0, 6000.);
+    ice_iem_ = CreateIEM(37.7, 0.);
+    rock_iem_ = CreateIEM(620.0, 0., false);
+    poro_model_ = CreatePorosity();
+    poro_leij_ = false;
+    p_atm_ = 101325.;
+    poro_ = 0.4;
+    rho_rock_ = 2170.;
+  }
+
+  int Jacobian(double T, double p, AmanziGeometry::Point& res, WhetStone::Tensor& jac) {
+    return EvaluateEnergyAndWaterContentAndJacobian_(T, p, res, jac);
+  }
+};
+
+
+class SurfaceIceModelTest : public SurfaceIceModel {
+ public:
+  SurfaceIceModelTest() {
+    Teuchos::ParameterList plist;
+    pd_ = Teuchos::rcp(new Flow::IcyHeightModel(plist));
+    uf_ = Teuchos::rcp(new Flow::UnfrozenFractionModel(plist));
+    liquid_eos_ = Teuchos::rcp(new Relations::EOSWater(plist));
+    ice_eos_ = Teuchos::rcp(new Relations::EOSIce(plist));
+    liquid_iem_ = CreateIEM(76.0, 6000.);
+    ice_iem_ = CreateIEM(37.7, 0.);
+    p_atm_ = 101325.;
+    gz_ = 9.80665;
+    M_ = 0.0180153;
+  }
+
+  int Jacobian(double T, double p, AmanziGeometry::Point& res, WhetStone::Tensor& jac) {
+    return EvaluateEnergyAndWaterContentAndJacobian_(T, p, res, jac);
+  }
+};
+
+
+// Compares the analytic Jacobian of a model to central differences of its
+// forward evaluation at (T, p).
+template<class Model>
+void CheckJacobian(Model& model, double T, double p) {
+  AmanziGeometry::Point res(2);
+  WhetStone::Tensor jac(2, 2);
+  CHECK_EQUAL(0, model.Jacobian(T, p, res, jac));
+
+  double e, wc;
+  CHECK_EQUAL(0, model.Evaluate(T, p, e, wc));
+  CHECK_CLOSE(e, res[0], 1.e-12 * std::abs(e));
+  CHECK_CLOSE(wc, res[1], 1.e-12 * std::abs(wc));
+
+  double eps_T = 1.e-4;
+  double eps_p = 1.;
+  double e_p, wc_p, e_m, wc_m;
+  model.Evaluate(T + eps_T, p, e_p, wc_p);
+  model.Evaluate(T - eps_T, p, e_m, wc_m);
+  double de_dT = (e_p - e_m) / (2*eps_T);
+  double dwc_dT = (wc_p - wc_m) / (2*eps_T);
+
+  model.Evaluate(T, p + eps_p, e_p, wc_p);
+  model.Evaluate(T, p - eps_p, e_m, wc_m);
+  double de_dp = (e_p - e_m) / (2*eps_p);
+  double dwc_dp = (wc_p - wc_m) / (2*eps_p);
+
+  // relative to the larger entry of each row, so that entries that should
+  // vanish are compared at the row's scale
+  double e_scale = std::max(std::abs(de_dT), std::abs(de_dp) * 1.e5);
+  double wc_scale = std::max(std::abs(dwc_dT), std::abs(dwc_dp) * 1.e5);
+  CHECK_CLOSE(de_dT, jac(0,0), 1.e-5 * e_scale);
+  CHECK_CLOSE(de_dp, jac(0,1), 1.e-5 * e_scale / 1.e5);
+  CHECK_CLOSE(dwc_dT, jac(1,0), 1.e-5 * wc_scale);
+  CHECK_CLOSE(dwc_dp, jac(1,1), 1.e-5 * wc_scale / 1.e5);
+}
+
+} // namespace
+
+
+SUITE(EWC_JACOBIAN) {
+
+  // unfrozen and frozen, unsaturated and saturated, away from the kinks at
+  // p = p_atm and the freezing point
+  TEST(PERMAFROST_MODEL) {
+    PermafrostModelTest model;
+    double Ts[3] = { 276., 272.5, 265. };
+    double ps[2] = { 95000., 150000. };
+    for (double T : Ts) {
+      for (double p : ps) CheckJacobian(model, T, p);
+    }
+  }
+
+  TEST(LIQUID_ICE_MODEL) {
+    LiquidIceModelTest model;
+    double Ts[3] = { 276., 272.5, 265. };
+    double ps[2] = { 95000., 150000. };
+    for (double T : Ts) {
+      for (double p : ps) CheckJacobian(model, T, p);
+    }
+  }
+
+  // ponded water, thawed, in the transition, and frozen
+  TEST(SURFACE_ICE_MODEL) {
+    SurfaceIceModelTest model;
+    double Ts[3] = { 276., 273.15, 265. };
+    double ps[2] = { 102000., 110000. };
+    for (double T : Ts) {
+      for (double p : ps) CheckJacobian(model, T, p);
+    }
+  }
+
+}
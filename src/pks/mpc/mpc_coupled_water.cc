@@ -3,6 +3,7 @@
 
 
 #include "mpc_surface_subsurface_helpers.hh"
+#include "surface_subsurface_index_map.hh"
 #include "mpc_coupled_water.hh"
 
 namespace Amanzi {
@@ -44,6 +45,9 @@ MPCCoupledWater::Setup(const Teuchos::Ptr<State>& S) {
   // call the MPC's setup, which calls the sub-pk's setups
   StrongMPC<PK_PhysicalBDF_Default>::Setup(S);
 
+  // build the surface/subsurface index maps used in coupling
+  GetSurfaceSubsurfaceIndexMap(surf_mesh_, domain_mesh_);
+
   // require the coupling fields, claim ownership
   S->RequireField(Keys::getKey(domain_surf_,"surface_subsurface_flux"), name_)
     ->SetMesh(surf_mesh_)->SetComponent("cell", AmanziMesh::CELL, 1);
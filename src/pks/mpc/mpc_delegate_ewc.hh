@@ -65,6 +65,10 @@ provides the initial guess to the nonlinear solve.
     * `"freeze-thaw cusp width (thawing) [K]`" ``[double]`` Controls a width
       over which to assume we are close to the latent heat cliff as we get
       warmer, and begins applying the EWC algorithm in `"ewc smarter`".
+
+    * `"finite difference Jacobian`" ``[bool]`` **false** Use finite
+      differences instead of the analytic Jacobian of energy and water content
+      in the cell-wise inverse solve.  Mostly useful for debugging.
         
     * `"pressure key`" ``[string]`` **DOMAIN-pressure**
     * `"temperature key`" ``[string]`` **DOMAIN-temperature**
@@ -2,6 +2,7 @@
 
 #include "mpc_delegate_water.hh"
 #include "mpc_surface_subsurface_helpers.hh"
+#include "surface_subsurface_index_map.hh"
 
 namespace Amanzi {
 
@@ -96,33 +97,26 @@ MPCDelegateWater::ModifyCorrection_WaterSpurtDamp(double h, Teuchos::RCP<const T
         Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu) {
   const double& patm = *S_next_->GetScalarData("atmospheric_pressure");
 
-  std::string face_entity;
-  if (Pu->SubVector(i_domain_)->Data()->HasComponent("face")){
-    face_entity = "face";
-  }else if (Pu->SubVector(i_domain_)->Data()->HasComponent("boundary_face")){
-    face_entity = "boundary_face";
-  }else{
-    Errors::Message message("Subsurface vector does not have face component.");
-    Exceptions::amanzi_throw(message);
-  }
-  
   Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh =
       u->SubVector(i_surf_)->Data()->Mesh();
-  int ncells_surf = surf_mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
 
   Teuchos::RCP<const CompositeVector> domain_u = u->SubVector(i_domain_)->Data();
   Teuchos::RCP<CompositeVector> domain_Pu = Pu->SubVector(i_domain_)->Data();
-  Epetra_MultiVector& domain_Pu_c = *domain_Pu->ViewComponent("cell", false);
+  std::string face_entity = DomainFaceComponent(*domain_Pu);
+  const Epetra_MultiVector& domain_u_f = *domain_u->ViewComponent(face_entity, false);
   Epetra_MultiVector& domain_Pu_f = *domain_Pu->ViewComponent(face_entity, false);
 
+  const SurfaceSubsurfaceIndexMap& map =
+      GetSurfaceSubsurfaceIndexMap(surf_mesh, domain_u->Mesh());
+  const std::vector<int>& idx = face_entity == "face" ? map.faces() : map.boundary_faces();
+  int ncells_surf = map.size();
+
   // Approach 2
   double damp = 1.;
   if (damp_the_spurt_) {
     for (int cs=0; cs!=ncells_surf; ++cs) {
-      AmanziMesh::Entity_ID f =
-          surf_mesh->entity_get_parent(AmanziMesh::CELL, cs);
-      double p_old = GetDomainFaceValue(*u->SubVector(i_domain_)->Data(), f);
-      double p_Pu = GetDomainFaceValue(*Pu->SubVector(i_domain_)->Data(), f);
+      double p_old = domain_u_f[0][idx[cs]];
+      double p_Pu = domain_Pu_f[0][idx[cs]];
       double p_new = p_old - p_Pu;
       if ((p_new > patm + cap_size_) && (p_old < patm)) {
         double my_damp = ((patm + cap_size_) - p_old) / (p_new - p_old);
@@ -151,23 +145,30 @@ MPCDelegateWater::ModifyCorrection_WaterSpurtCap(double h, Teuchos::RCP<const Tr
 
   Teuchos::RCP<const AmanziMesh::Mesh> surf_mesh =
       u->SubVector(i_surf_)->Data()->Mesh();
-  int ncells_surf = surf_mesh->num_entities(AmanziMesh::CELL, AmanziMesh::Parallel_type::OWNED);
 
   Teuchos::RCP<const CompositeVector> domain_u = u->SubVector(i_domain_)->Data();
   Teuchos::RCP<CompositeVector> domain_Pu = Pu->SubVector(i_domain_)->Data();
+  std::string face_entity = DomainFaceComponent(*domain_Pu);
+  const Epetra_MultiVector& domain_u_f = *domain_u->ViewComponent(face_entity, false);
+  Epetra_MultiVector& domain_Pu_f = *domain_Pu->ViewComponent(face_entity, false);
+
+  const SurfaceSubsurfaceIndexMap& map =
+      GetSurfaceSubsurfaceIndexMap(surf_mesh, domain_u->Mesh());
+  const std::vector<int>& idx = face_entity == "face" ? map.faces() : map.boundary_faces();
+  int ncells_surf = map.size();
 
   // Approach 3
   int n_modified = 0;
   if (cap_the_spurt_) {
     for (int cs=0; cs!=ncells_surf; ++cs) {
-      AmanziMesh::Entity_ID f = surf_mesh->entity_get_parent(AmanziMesh::CELL, cs);
+      AmanziMesh::Entity_ID f = map.faces()[cs];
 
-      double p_old = GetDomainFaceValue(*u->SubVector(i_domain_)->Data(), f);
-      double p_Pu = GetDomainFaceValue(*Pu->SubVector(i_domain_)->Data(), f);
+      double p_old = domain_u_f[0][idx[cs]];
+      double p_Pu = domain_Pu_f[0][idx[cs]];
       double p_new = p_old - p_Pu / damp;
       if ((p_new > patm + cap_size_) && (p_old < patm)) {
         double p_corrected = p_old - (patm + cap_size_);
-        SetDomainFaceValue(*domain_Pu, f, p_corrected);
+        domain_Pu_f[0][idx[cs]] = p_corrected;
         
         n_modified++;
         if (vo_->os_OK(Teuchos::VERB_HIGH))
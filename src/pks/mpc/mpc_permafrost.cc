@@ -7,6 +7,7 @@
 #include "Operator_CellBndFace.hh"
 #include "mpc_delegate_ewc_subsurface.hh"
 #include "mpc_surface_subsurface_helpers.hh"
+#include "surface_subsurface_index_map.hh"
 #include "permafrost_model.hh"
 #include "surface_ice_model.hh"
 #include "energy_base.hh"
@@ -105,6 +106,9 @@ MPCPermafrost::Setup(const Teuchos::Ptr<State>& S) {
   // the subsurface block operator
   MPCSubsurface::Setup(S);
 
+  // build the surface/subsurface index maps used in coupling
+  GetSurfaceSubsurfaceIndexMap(surf_mesh_, domain_mesh_);
+
   // require the coupling fields, claim ownership
   S->RequireField(mass_exchange_key_, name_)
       ->SetMesh(surf_mesh_)
@@ -7,6 +7,11 @@ Author: Ethan Coon
 
 ------------------------------------------------------------------------- */
 
+#include <algorithm>
+#include <numeric>
+
+#include "Teuchos_Time.hpp"
+
 #include "primary_variable_field_evaluator.hh"
 #include "mpc_surface_subsurface_helpers.hh"
 
@@ -30,7 +35,6 @@ MPCPermafrostSplitFluxColumnsSubcycled::MPCPermafrostSplitFluxColumnsSubcycled(T
 bool MPCPermafrostSplitFluxColumnsSubcycled::AdvanceStep(double t_old, double t_new, bool reinit)
 {
   Teuchos::OSTab tab = vo_->getOSTab();
-  int my_pid = S_next_->GetMesh("surface_star")->get_comm()->MyPID();
   // Advance the star system 
   bool fail = false;
   if (vo_->os_OK(Teuchos::VERB_EXTREME))
@@ -43,80 +47,124 @@ bool MPCPermafrostSplitFluxColumnsSubcycled::AdvanceStep(double t_old, double t_
   // Copy star's new value into primary's old value
   CopyStarToPrimary(t_new - t_old);
 
-  // Now advance the primary
+  // Now advance the primary, one column at a time
+  col_wall_times_.resize(col_domains_.size());
+  col_nsteps_.resize(col_domains_.size());
   for (int i=1; i!=sub_pks_.size(); ++i) {
-    auto col_domain = col_domains_[i-1];
-    double t_inner = t_old;
-    bool done = false;
+    Teuchos::Time col_timer("column", true);
+    col_nsteps_[i-1] = AdvanceColumn_(i, t_old, t_new);
+    col_wall_times_[i-1] = col_timer.totalElapsedTime();
+  }
+  S_inter_->set_time(t_old);
+
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) ReportColumnTimings_();
+
+  // Copy the primary into the star to advance
+  CopyPrimaryToStar(S_next_.ptr(), S_next_.ptr());
+
+  return false;
+}
+
+
+// -----------------------------------------------------------------------------
+// Subcycle column i from t_old to t_new, returning the number of successful
+// steps taken.  Only the column's own domains are assigned between S_inter_
+// and S_next_.
+// -----------------------------------------------------------------------------
+int MPCPermafrostSplitFluxColumnsSubcycled::AdvanceColumn_(int i, double t_old, double t_new)
+{
+  Teuchos::OSTab tab = vo_->getOSTab();
+  int my_pid = S_next_->GetMesh("surface_star")->get_comm()->MyPID();
+
+  const auto& col_domain = col_domains_[i-1];
+  double t_inner = t_old;
+  int nsteps = 0;
+  bool done = false;
+  if (vo_->os_OK(Teuchos::VERB_EXTREME))
+    *vo_->os() << "Beginning timestepping on " << col_domain << std::endl;
+
+  S_inter_->set_time(t_old);
+  while (!done) {
+    double dt_inner = std::min(sub_pks_[i]->get_dt(), t_new - t_inner);
+    *S_next_->GetScalarData("dt", "coordinator") = dt_inner;
+    S_next_->set_time(t_inner + dt_inner);
+    bool fail_inner = sub_pks_[i]->AdvanceStep(t_inner, t_inner+dt_inner, false);
     if (vo_->os_OK(Teuchos::VERB_EXTREME))
-      *vo_->os() << "Beginning timestepping on " << col_domain << std::endl;
-
-    S_inter_->set_time(t_old);
-    while (!done) {
-      double dt_inner = std::min(sub_pks_[i]->get_dt(), t_new - t_inner);
-      *S_next_->GetScalarData("dt", "coordinator") = dt_inner;
-      S_next_->set_time(t_inner + dt_inner);
-      bool fail_inner = sub_pks_[i]->AdvanceStep(t_inner, t_inner+dt_inner, false);
+      *vo_->os() << "  step failed? " << fail_inner << std::endl;
+    bool valid_inner = sub_pks_[i]->ValidStep();
+    if (vo_->os_OK(Teuchos::VERB_EXTREME)) {
+      *vo_->os() << "  step valid? " << valid_inner << std::endl
+                 << "  " << col_domain << " (" << my_pid << ") Step: " << t_inner/86400.0
+                 << " (" << dt_inner/86400. << ") failed/!valid = " << fail_inner
+                 << "," << !valid_inner << std::endl;
+    }
+
+    if (fail_inner || !valid_inner) {
+      dt_inner = sub_pks_[i]->get_dt();
+      S_next_->AssignDomain(*S_inter_, col_domain);
+      S_next_->AssignDomain(*S_inter_, "surface_"+col_domain);
+      S_next_->AssignDomain(*S_inter_, "snow_"+col_domain);
+      //S_next_->AssignDomain(*S_inter_, "surface_star");
+      S_next_->set_time(S_inter_->time());
+      S_next_->set_cycle(S_inter_->cycle());
+      //*S_next_ = *S_inter_;
+
       if (vo_->os_OK(Teuchos::VERB_EXTREME))
-        *vo_->os() << "  step failed? " << fail_inner << std::endl;
-      bool valid_inner = sub_pks_[i]->ValidStep();
-      if (vo_->os_OK(Teuchos::VERB_EXTREME)) {
-        *vo_->os() << "  step valid? " << valid_inner << std::endl;
-
-      // DEBUGGING
-      std::cout << col_domain << " (" << my_pid << ") Step: " << t_inner/86400.0 << " (" << dt_inner/86400. 
-                << ") failed/!valid = " << fail_inner << "," << !valid_inner << std::endl;
-      // END DEBUGGING
-      }
-      
-      if (fail_inner || !valid_inner) {
-        dt_inner = sub_pks_[i]->get_dt();
-        S_next_->AssignDomain(*S_inter_, col_domain);
-        S_next_->AssignDomain(*S_inter_, "surface_"+col_domain);
-        S_next_->AssignDomain(*S_inter_, "snow_"+col_domain);
-        //S_next_->AssignDomain(*S_inter_, "surface_star");
-        S_next_->set_time(S_inter_->time());
-        S_next_->set_cycle(S_inter_->cycle());
-        //*S_next_ = *S_inter_;
-
-        if (vo_->os_OK(Teuchos::VERB_EXTREME))
-          *vo_->os() << "  failed, new timestep is " << dt_inner << std::endl;
+        *vo_->os() << "  failed, new timestep is " << dt_inner << std::endl;
         
-      } else {
-        sub_pks_[i]->CommitStep(t_inner, t_inner + dt_inner, S_next_);
-        t_inner += dt_inner;
-        if (t_inner >= t_new - 1.e-10) {
-          done = true;
-        }
-
-        S_inter_->AssignDomain(*S_next_, col_domain);
-        S_inter_->AssignDomain(*S_next_, "surface_"+col_domain);
-        S_inter_->AssignDomain(*S_next_, "snow_"+col_domain);
-        //        S_inter_->AssignDomain(*S_next_, "surface_star");
-        S_inter_->set_time(S_next_->time());
-        S_inter_->set_cycle(S_next_->cycle());
-        // *S_inter_ = *S_next_;
-        dt_inner = sub_pks_[i]->get_dt();
-        if (vo_->os_OK(Teuchos::VERB_EXTREME))
-          *vo_->os() << "  success, new timestep is " << dt_inner << std::endl;
+    } else {
+      sub_pks_[i]->CommitStep(t_inner, t_inner + dt_inner, S_next_);
+      t_inner += dt_inner;
+      nsteps++;
+      if (t_inner >= t_new - 1.e-10) {
+        done = true;
       }
 
-      if (dt_inner < 1.e-4) {
-        Errors::Message msg;
-        msg << "Column " << col_domain << " on PID " << my_pid << " crashing timestep in subcycling: dt = " << dt_inner;
-        Exceptions::amanzi_throw(msg);
-      }
+      S_inter_->AssignDomain(*S_next_, col_domain);
+      S_inter_->AssignDomain(*S_next_, "surface_"+col_domain);
+      S_inter_->AssignDomain(*S_next_, "snow_"+col_domain);
+      //        S_inter_->AssignDomain(*S_next_, "surface_star");
+      S_inter_->set_time(S_next_->time());
+      S_inter_->set_cycle(S_next_->cycle());
+      // *S_inter_ = *S_next_;
+      dt_inner = sub_pks_[i]->get_dt();
+      if (vo_->os_OK(Teuchos::VERB_EXTREME))
+        *vo_->os() << "  success, new timestep is " << dt_inner << std::endl;
+    }
 
+    if (dt_inner < 1.e-4) {
+      Errors::Message msg;
+      msg << "Column " << col_domain << " on PID " << my_pid << " crashing timestep in subcycling: dt = " << dt_inner;
+      Exceptions::amanzi_throw(msg);
     }
   }
-  S_inter_->set_time(t_old);
+  return nsteps;
+}
 
-  // Copy the primary into the star to advance
-  CopyPrimaryToStar(S_next_.ptr(), S_next_.ptr());
 
-  return false;
+// -----------------------------------------------------------------------------
+// Per-column wall time, to expose load imbalance between columns (e.g. frozen
+// vs thawed) on this process.
+// -----------------------------------------------------------------------------
+void MPCPermafrostSplitFluxColumnsSubcycled::ReportColumnTimings_()
+{
+  if (col_wall_times_.size() == 0) return;
+
+  auto minmax = std::minmax_element(col_wall_times_.begin(), col_wall_times_.end());
+  double total = std::accumulate(col_wall_times_.begin(), col_wall_times_.end(), 0.);
+  int total_steps = std::accumulate(col_nsteps_.begin(), col_nsteps_.end(), 0);
+  int i_max = minmax.second - col_wall_times_.begin();
+
+  Teuchos::OSTab tab = vo_->getOSTab();
+  *vo_->os() << "Column timings [s] on " << col_wall_times_.size() << " columns: "
+             << "min = " << *minmax.first
+             << ", mean = " << total / col_wall_times_.size()
+             << ", max = " << *minmax.second << " (" << col_domains_[i_max]
+             << ", " << col_nsteps_[i_max] << " steps)"
+             << ", total steps = " << total_steps << std::endl;
 }
 
+
 bool MPCPermafrostSplitFluxColumnsSubcycled::ValidStep() 
 {
   return true;
@@ -33,6 +33,10 @@ dE_s / dt = (dE_s / dt)^* + QE_ext + h * Q_ext + qE_ss + h * q_ss
 dE / dt = div (  kappa grad T) + hq )
 kappa grad T |_s = qE_ss
 
+This version subcycles each column independently.  At high verbosity, the
+wall time spent in each column is reported to help diagnose load imbalance
+between columns.
+
 
 ------------------------------------------------------------------------- */
 
@@ -72,6 +76,15 @@ class MPCPermafrostSplitFluxColumnsSubcycled : public MPCPermafrostSplitFluxColu
   virtual void CommitStep(double t_old, double t_new,
                           const Teuchos::RCP<State>& S);
   
+ protected:
+  // -- subcycle a single column, returns the number of steps taken
+  int AdvanceColumn_(int i, double t_old, double t_new);
+  void ReportColumnTimings_();
+
+ protected:
+  std::vector<double> col_wall_times_;
+  std::vector<int> col_nsteps_;
+
  private:
   // factory registration
   static RegisteredPKFactory<MPCPermafrostSplitFluxColumnsSubcycled> reg_;
@@ -73,6 +73,7 @@ void MPCSubsurface::Setup(const Teuchos::Ptr<State>& S)
 
   // set up debugger
   db_ = sub_pks_[0]->debugger();
+  db_gate_ = sub_pks_[0]->debugger_gate();
 
   // Get the sub-blocks from the sub-PK's preconditioners.
   Teuchos::RCP<Operators::Operator> pcA = sub_pks_[0]->preconditioner();
@@ -119,6 +120,11 @@ void MPCSubsurface::Setup(const Teuchos::Ptr<State>& S)
     Exceptions::amanzi_throw(message);
   }
 
+  // policy for reusing the assembled preconditioner
+  if (plist_->isSublist("preconditioner reuse")) {
+    precon_reuse_ = PreconditionerReuse(plist_->sublist("preconditioner reuse"));
+  }
+
   // create offdiagonal blocks
   if (precon_type_ != PRECON_NONE && precon_type_ != PRECON_BLOCK_DIAGONAL) {
     std::vector<AmanziMesh::Entity_kind> locations2(2);
@@ -443,6 +449,21 @@ void MPCSubsurface::CommitStep(double t_old, double t_new, const Teuchos::RCP<St
     ewc_->commit_state(dt,S);
   }
   update_pcs_ = 0;
+
+  if (precon_reuse_.enabled() && vo_->os_OK(Teuchos::VERB_HIGH)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    precon_reuse_.WriteStatistics(*vo_->os());
+  }
+}
+
+
+// error norm, recording the nonlinear contraction for preconditioner reuse
+double MPCSubsurface::ErrorNorm(Teuchos::RCP<const TreeVector> u,
+        Teuchos::RCP<const TreeVector> du)
+{
+  double enorm = StrongMPC<PK_PhysicalBDF_Default>::ErrorNorm(u, du);
+  precon_reuse_.RecordErrorNorm(S_next_->time(), enorm);
+  return enorm;
 }
 
 
@@ -467,6 +488,14 @@ void MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector
 {
   Teuchos::OSTab tab = vo_->getOSTab();
 
+  // keep the last assembled preconditioner, all blocks included, if it is
+  // still good enough
+  if (precon_type_ != PRECON_NONE && !precon_reuse_.Rebuild(h)) {
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "reusing preconditioner" << std::endl;
+    return;
+  }
+
   if (precon_type_ == PRECON_NONE) {
     // nothing to do
   } else if (precon_type_ == PRECON_BLOCK_DIAGONAL) {
@@ -570,9 +599,10 @@ void MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector
       upwinding_hkr_->Update(S_next_.ptr(), db_.ptr());
 
       // -- stick zeros in the boundary faces
-      Epetra_MultiVector enth_kr_bf(*enth_kr->ViewComponent("boundary_face",false));
-      enth_kr_bf.PutScalar(0.0);
-      enth_kr_uw->ViewComponent("face",false)->Export(enth_kr_bf,
+      Teuchos::RCP<Epetra_MultiVector> zero_bf = workspace_.Get("zero boundary faces",
+              enth_kr->ViewComponent("boundary_face",false)->Map(), 1);
+      zero_bf->PutScalar(0.0);
+      enth_kr_uw->ViewComponent("face",false)->Export(*zero_bf,
               mesh_->exterior_face_importer(), Insert);
 
       if (is_fv_) {
@@ -606,11 +636,9 @@ void MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector
         upwinding_dhkr_dT_->Update(S_next_.ptr(), db_.ptr());
 
         // -- stick zeros in the boundary faces
-        Epetra_MultiVector enth_kr_bf(*enth_kr->ViewComponent("boundary_face",false));
-        enth_kr_bf.PutScalar(0.0);
-        denth_kr_dp_uw_nc->ViewComponent("face",false)->Export(enth_kr_bf,
+        denth_kr_dp_uw_nc->ViewComponent("face",false)->Export(*zero_bf,
                 mesh_->exterior_face_importer(), Insert);
-        denth_kr_dT_uw_nc->ViewComponent("face",false)->Export(enth_kr_bf,
+        denth_kr_dT_uw_nc->ViewComponent("face",false)->Export(*zero_bf,
                 mesh_->exterior_face_importer(), Insert);
 
         denth_kr_dp_uw =
@@ -628,8 +656,9 @@ void MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector
       // -- update the local matrices, div h * kr grad
       ddivhq_dp_->UpdateMatrices(Teuchos::null, Teuchos::null);
       // -- determine the advective fluxes, q_a = h * kr grad p
-      CompositeVector adv_flux(*flux, INIT_MODE_ZERO);
-      Teuchos::Ptr<CompositeVector> adv_flux_ptr(&adv_flux);
+      Teuchos::RCP<CompositeVector> adv_flux = workspace_.Get("advective flux", flux->Map());
+      adv_flux->PutScalar(0.);
+      Teuchos::Ptr<CompositeVector> adv_flux_ptr = adv_flux.ptr();
       ddivhq_dp_->UpdateFlux(up->SubVector(0)->Data().ptr(), adv_flux_ptr);
       // -- add in components div (d h*kr / dp) grad q_a / (h*kr)
       ddivhq_dp_->UpdateMatricesNewtonCorrection(adv_flux_ptr, up->SubVector(0)->Data().ptr());
@@ -663,6 +692,9 @@ void MPCSubsurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector
     ewc_->UpdatePreconditioner(t,up,h);
   }
   update_pcs_++;
+
+  if (vo_->os_OK(Teuchos::VERB_EXTREME))
+    *vo_->os() << "workspace allocations: " << workspace_.TakeAllocationCount() << std::endl;
 }
 
 
@@ -677,8 +709,9 @@ int MPCSubsurface::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
     *vo_->os() << "Precon application:" << std::endl;
 
   // write residuals
-  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
-    *vo_->os() << "Residuals:" << std::endl;
+  if (db_gate_->Collect()) {
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "Residuals:" << std::endl;
     std::vector<std::string> vnames;
     vnames.push_back("  r_p"); vnames.push_back("  r_T");
     std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
@@ -699,8 +732,9 @@ int MPCSubsurface::ApplyPreconditioner(Teuchos::RCP<const TreeVector> u,
     ierr = preconditioner_->ApplyInverse(*u, *Pu);
   }
 
-  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
-    *vo_->os() << "PC * residuals:" << std::endl;
+  if (db_gate_->Collect()) {
+    if (vo_->os_OK(Teuchos::VERB_HIGH))
+      *vo_->os() << "PC * residuals:" << std::endl;
     std::vector<std::string> vnames;
     vnames.push_back("  PC*r_p"); vnames.push_back("  PC*r_T");
     std::vector< Teuchos::Ptr<const CompositeVector> > vecs;
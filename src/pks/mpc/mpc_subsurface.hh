@@ -126,6 +126,10 @@ algorithms are supported by the `EWC Globalization Delegate`_ object.
 
     * `"ewc delegate`" ``[mpc-delegate-ewc-spec]`` A `EWC Globalization Delegate`_ spec.
 
+    * `"preconditioner reuse`" ``[preconditioner-reuse-spec]`` **optional**
+      Keep the assembled preconditioner, including all off-diagonal blocks,
+      across iterations and timesteps.  See PreconditionerReuse_.
+
     INCLUDES:
 
     - ``[strong-mpc-spec]`` *Is a* StrongMPC_.
@@ -137,6 +141,7 @@ algorithms are supported by the `EWC Globalization Delegate`_ object.
 
 #include "TreeOperator.hh"
 #include "pk_physical_bdf_default.hh"
+#include "preconditioner_reuse.hh"
 #include "strong_mpc.hh"
 
 namespace Amanzi {
@@ -191,6 +196,10 @@ class MPCSubsurface : public StrongMPC<PK_PhysicalBDF_Default> {
 
   virtual void UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> up, double h);
 
+  // error norm, also monitored for preconditioner reuse
+  virtual double ErrorNorm(Teuchos::RCP<const TreeVector> u,
+                           Teuchos::RCP<const TreeVector> du);
+
   // preconditioner application
   virtual int ApplyPreconditioner(Teuchos::RCP<const TreeVector> u, Teuchos::RCP<TreeVector> Pu);
   Teuchos::RCP<Operators::TreeOperator> preconditioner() { return preconditioner_; }
@@ -269,7 +278,9 @@ class MPCSubsurface : public StrongMPC<PK_PhysicalBDF_Default> {
   // cruft for easier global debugging
   bool dump_;
   int update_pcs_;
+  PreconditionerReuse precon_reuse_;
   Teuchos::RCP<Debugger> db_;
+  Teuchos::RCP<DebuggerGate> db_gate_;
 
 private:
   // factory registration
@@ -232,16 +232,19 @@ void MPCSurface::UpdatePreconditioner(double t, Teuchos::RCP<const TreeVector> u
     auto dh_dp = S_next_->GetFieldData(Keys::getDerivKey(pd_bar_key_, pres_key_));
 
     // -- add it in
-    CompositeVector dE_dh(dE_dp->Map());
-    dE_dh.ReciprocalMultiply(1./h, *dh_dp, *dE_dp, 0.);
+    Teuchos::RCP<CompositeVector> dE_dh = workspace_.Get("dE_dh", dE_dp->Map());
+    dE_dh->ReciprocalMultiply(1./h, *dh_dp, *dE_dp, 0.);
     db_->WriteVector("  de_dp", dE_dp.ptr(), false);
-    dE_dp_->AddAccumulationTerm(dE_dh, "cell");
+    dE_dp_->AddAccumulationTerm(*dE_dh, "cell");
 
     // write for debugging
     db_->WriteVector("  de_dp", dE_dp.ptr(), false);
-    db_->WriteVector("  de_dh", Teuchos::ptr(&dE_dh), false);
+    db_->WriteVector("  de_dh", dE_dh.ptr(), false);
   }
   update_pcs_++;
+
+  if (vo_->os_OK(Teuchos::VERB_EXTREME))
+    *vo_->os() << "workspace allocations: " << workspace_.TakeAllocationCount() << std::endl;
 }
 
 
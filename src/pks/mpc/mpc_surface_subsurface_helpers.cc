@@ -1,4 +1,5 @@
 #include "mpc_surface_subsurface_helpers.hh"
+#include "surface_subsurface_index_map.hh"
 #include "errors.hh"
 
 namespace Amanzi {
@@ -6,29 +7,15 @@ namespace Amanzi {
 void
 CopySurfaceToSubsurface(const CompositeVector& surf,
                         const Teuchos::Ptr<CompositeVector>& sub) {
-  
   const Epetra_MultiVector& surf_c = *surf.ViewComponent("cell",false);
-  
-  for (unsigned int sc=0; sc!=surf_c.MyLength(); ++sc) {
-    AmanziMesh::Entity_ID f =
-        surf.Mesh()->entity_get_parent(AmanziMesh::CELL, sc);
-    SetDomainFaceValue(*sub, f, surf_c[0][sc]);
-  }
+  GetSurfaceSubsurfaceIndexMap(surf.Mesh(), sub->Mesh()).Scatter(surf_c, *sub);
 }
 
 void
 CopySubsurfaceToSurface(const CompositeVector& sub,
                         const Teuchos::Ptr<CompositeVector>& surf) {
- 
-  //  const Epetra_MultiVector& sub_f = *sub.ViewComponent("face",false);
   Epetra_MultiVector& surf_c = *surf->ViewComponent("cell",false);
-
-  for (unsigned int sc=0; sc!=surf_c.MyLength(); ++sc) {
-    AmanziMesh::Entity_ID f =
-        surf->Mesh()->entity_get_parent(AmanziMesh::CELL, sc);
-    surf_c[0][sc] = GetDomainFaceValue(sub, f);
-
-  }
+  GetSurfaceSubsurfaceIndexMap(surf->Mesh(), sub.Mesh()).Gather(sub, surf_c);
 }
 
 void
@@ -40,64 +27,50 @@ MergeSubsurfaceAndSurfacePressure(const CompositeVector& h_prev,
   const Epetra_MultiVector& h_c = *h_prev.ViewComponent("cell",false);
   double p_atm = 101325.;
 
-  for (unsigned int sc=0; sc!=surf_p_c.MyLength(); ++sc) {
-    AmanziMesh::Entity_ID f =
-        surf_p->Mesh()->entity_get_parent(AmanziMesh::CELL, sc);
+  const SurfaceSubsurfaceIndexMap& map =
+      GetSurfaceSubsurfaceIndexMap(surf_p->Mesh(), sub_p->Mesh());
+  std::string face_entity = DomainFaceComponent(*sub_p);
+  const std::vector<int>& idx = face_entity == "face" ? map.faces() : map.boundary_faces();
+  Epetra_MultiVector& sub_p_f = *sub_p->ViewComponent(face_entity, false);
+
+  for (int sc=0; sc!=map.size(); ++sc) {
     if (h_c[0][sc] > 0. && surf_p_c[0][sc] > p_atm) {
-      SetDomainFaceValue(*sub_p, f,  surf_p_c[0][sc]);
+      sub_p_f[0][idx[sc]] = surf_p_c[0][sc];
     } else {
-      surf_p_c[0][sc] = GetDomainFaceValue(*sub_p, f);
+      surf_p_c[0][sc] = sub_p_f[0][idx[sc]];
     }
   }
 }
 
-double
-GetDomainFaceValue(const CompositeVector& sub_p, int f){
-
-  std::string face_entity;
-  if (sub_p.HasComponent("face")){
-    face_entity = "face";
-  }else if (sub_p.HasComponent("boundary_face")){
-    face_entity = "boundary_face";
-  }else{
-    Errors::Message message("Subsurface vector does not have face component.");
-    Exceptions::amanzi_throw(message);
+std::string
+DomainFaceComponent(const CompositeVector& sub_p) {
+  if (sub_p.HasComponent("face")) {
+    return "face";
+  } else if (sub_p.HasComponent("boundary_face")) {
+    return "boundary_face";
   }
+  Errors::Message message("Subsurface vector does not have face component.");
+  Exceptions::amanzi_throw(message);
+  return "";
+}
 
-  if (face_entity == "face"){
-    const Epetra_MultiVector& vec = *sub_p.ViewComponent(face_entity, false);
-    return vec[0][f];;
-  }else if (face_entity == "boundary_face"){
-    int bf = sub_p.Mesh()->exterior_face_map(false).LID(sub_p.Mesh()->face_map(false).GID(f));
-    const Epetra_MultiVector& vec = *sub_p.ViewComponent(face_entity, false);
-    return vec[0][bf];
+double
+GetDomainFaceValue(const CompositeVector& sub_p, int f){
+  if (sub_p.HasComponent("face")) {
+    return (*sub_p.ViewComponent("face", false))[0][f];
   }
-
+  int bf = GetFaceToBoundaryFaceMap(sub_p.Mesh())[f];
+  return (*sub_p.ViewComponent(DomainFaceComponent(sub_p), false))[0][bf];
 }
 
 void
 SetDomainFaceValue(CompositeVector& sub_p, int f, double value){
-
-  std::string face_entity;
-  if (sub_p.HasComponent("face")){
-    face_entity = "face";
-  }else if (sub_p.HasComponent("boundary_face")){
-    face_entity = "boundary_face";
-  }else{
-    Errors::Message message("Subsurface vector does not have face component.");
-    Exceptions::amanzi_throw(message);
+  if (sub_p.HasComponent("face")) {
+    (*sub_p.ViewComponent("face", false))[0][f] = value;
+    return;
   }
-  
-  if (face_entity == "face"){
-    Epetra_MultiVector& vec = *sub_p.ViewComponent(face_entity, false);
-    vec[0][f] = value;
-  }else if (face_entity == "boundary_face"){
-    int bf = sub_p.Mesh()->exterior_face_map(false).LID(sub_p.Mesh()->face_map(false).GID(f));
-    Epetra_MultiVector& vec = *sub_p.ViewComponent(face_entity, false);
-    vec[0][bf] = value;
-  }
-
-}  
+  int bf = GetFaceToBoundaryFaceMap(sub_p.Mesh())[f];
+  (*sub_p.ViewComponent(DomainFaceComponent(sub_p), false))[0][bf] = value;
+}
 
-  
 } // namespace
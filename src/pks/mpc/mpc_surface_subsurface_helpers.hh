@@ -1,6 +1,7 @@
 #ifndef PKS_MPC_SURFACE_SUBSURFACE_HELPERS_HH_
 #define PKS_MPC_SURFACE_SUBSURFACE_HELPERS_HH_
 
+#include <string>
 #include "CompositeVector.hh"
 
 namespace Amanzi {
@@ -17,6 +18,13 @@ void
 MergeSubsurfaceAndSurfacePressure(const CompositeVector& kr_surf,
 				  const Teuchos::Ptr<CompositeVector>& sub_p,
 				  const Teuchos::Ptr<CompositeVector>& surf_p);
+
+// "face" or "boundary_face", whichever the subsurface vector has
+std::string
+DomainFaceComponent(const CompositeVector& sub_p);
+
+// Single-face access.  Loops over all surface cells should instead use the
+// index map in surface_subsurface_index_map.hh.
 double
 GetDomainFaceValue(const CompositeVector& sub_p, int f);
 
@@ -0,0 +1,55 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Subcycling of a PK from t_old to t_new with its own timestep.
+
+  Subcycle() drives the substeps, calling functors for the states and PK:
+
+    prepare(t0, t1)    a substep from t0 to t1 is attempted: S_inter_ must
+                       be set to t0 and S_next_ to t1, so that the PK sees
+                       h = t1 - t0
+    advance(t0, t1)    advance the PK, returning true on failure
+    commit(t0, t1)     the substep succeeded: commit it, and copy S_next_
+                       to S_inter_
+    rollback(t0, t1)   the substep failed: copy S_inter_ back to S_next_
+    get_dt()           the PK's timestep, after advance() has adjusted it
+
+  It returns true, failing the subcycle, if the PK's timestep falls below
+  min_dt.
+*/
+
+#ifndef ATS_MPC_SUBCYCLE_HH_
+#define ATS_MPC_SUBCYCLE_HH_
+
+#include <algorithm>
+
+namespace Amanzi {
+
+template<class Prepare, class Advance, class Commit, class Rollback, class GetDt>
+bool Subcycle(double t_old, double t_new, double min_dt,
+              const Prepare& prepare, const Advance& advance, const Commit& commit,
+              const Rollback& rollback, const GetDt& get_dt)
+{
+  double t_inner = t_old;
+  double dt_inner = get_dt();
+  while (t_inner < t_new - 1.e-10) {
+    double t_next = t_inner + std::min(dt_inner, t_new - t_inner);
+    prepare(t_inner, t_next);
+    if (advance(t_inner, t_next)) {
+      rollback(t_inner, t_next);
+    } else {
+      commit(t_inner, t_next);
+      t_inner = t_next;
+    }
+    dt_inner = get_dt();
+    if (dt_inner < min_dt) return true;
+  }
+  return false;
+}
+
+} // namespace
+
+#endif
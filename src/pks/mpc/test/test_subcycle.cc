@@ -0,0 +1,91 @@
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "subcycle.hh"
+
+using namespace Amanzi;
+
+// A PK whose substeps fail when they are longer than max_dt, halving its
+// timestep, and which grows its timestep by 1.5 after a success.  Like the
+// BDF PKs, it takes h from the times of the intermediate and next states.
+struct MockSubcycledPK {
+  MockSubcycledPK(double dt_, double max_dt_) :
+      dt(dt_), max_dt(max_dt_), t_inter(0.), t_next(0.), nfailed(0) {}
+
+  bool Advance(double t0, double t1) {
+    double h = t_next - t_inter;
+    hs.push_back(h);
+    CHECK_CLOSE(t1 - t0, h, 1.e-12);
+    CHECK_CLOSE(t0, t_inter, 1.e-12);
+    if (h > max_dt) {
+      dt = h / 2;
+      nfailed++;
+      return true;
+    }
+    dt = 1.5 * h;
+    return false;
+  }
+
+  double dt, max_dt;
+  double t_inter, t_next;
+  int nfailed;
+  std::vector<double> hs;
+  std::vector<double> committed;
+};
+
+
+bool SubcycleMock(MockSubcycledPK& pk, double t_old, double t_new, double min_dt) {
+  pk.t_inter = t_old;
+  pk.t_next = t_new;
+  return Subcycle(t_old, t_new, min_dt,
+                  [&](double t0, double t1) { pk.t_inter = t0; pk.t_next = t1; },
+                  [&](double t0, double t1) { return pk.Advance(t0, t1); },
+                  [&](double, double t1) { pk.committed.push_back(t1); },
+                  [](double, double) {},
+                  [&]() { return pk.dt; });
+}
+
+
+// Every substep, not just the first, must see h equal to its own length.
+TEST(SUBCYCLE_SUBSTEP_TIMES) {
+  MockSubcycledPK pk(0.25, 1.0);
+  bool fail = SubcycleMock(pk, 10.0, 11.0, 1.e-4);
+  CHECK(!fail);
+  CHECK_EQUAL(0, pk.nfailed);
+
+  // 0.25 + 0.375 + 0.375 (truncated from 0.5625)
+  CHECK_EQUAL(3, (int) pk.committed.size());
+  CHECK_CLOSE(10.25, pk.committed[0], 1.e-12);
+  CHECK_CLOSE(10.625, pk.committed[1], 1.e-12);
+  CHECK_CLOSE(11.0, pk.committed[2], 1.e-12);
+  CHECK_CLOSE(0.375, pk.hs[1], 1.e-12);
+  CHECK_CLOSE(0.375, pk.hs[2], 1.e-12);
+}
+
+
+// Failed substeps are retried from the same time with a smaller timestep.
+TEST(SUBCYCLE_FAILED_SUBSTEPS) {
+  MockSubcycledPK pk(1.0, 0.3);
+  bool fail = SubcycleMock(pk, 0.0, 1.0, 1.e-4);
+  CHECK(!fail);
+  CHECK(pk.nfailed > 0);
+  CHECK(pk.committed.size() >= 2);
+  CHECK_CLOSE(1.0, pk.committed.back(), 1.e-12);
+
+  double t = 0.;
+  for (double t1 : pk.committed) {
+    CHECK(t1 - t <= 0.3 + 1.e-12);
+    t = t1;
+  }
+  for (double h : pk.hs) CHECK(h <= 1.0 + 1.e-12);
+}
+
+
+// A timestep below the minimum fails the subcycle.
+TEST(SUBCYCLE_MINIMUM_DT) {
+  MockSubcycledPK pk(1.0, 1.e-6);
+  bool fail = SubcycleMock(pk, 0.0, 1.0, 1.e-4);
+  CHECK(fail);
+  CHECK_EQUAL(0, (int) pk.committed.size());
+}
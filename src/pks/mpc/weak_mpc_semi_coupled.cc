@@ -185,14 +185,11 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
   //copying pressure
   if(!sg_model_){
     const Epetra_MultiVector& surfstar_pres = *S_next_->GetFieldData("surface_star-pressure")->ViewComponent("cell", false);
+    const std::vector<Key>& surf_pres_keys = ColumnKeys_("surface_column", "pressure");
     for (unsigned c=0; c<size_t; c++){
       if(surfstar_pres[0][c] > 101325.00){
-	std::stringstream name;
-	int id = S_->GetMesh("surface")->cell_map(false).GID(c);
-	
-	name << "surface_column_" << id;
-	Epetra_MultiVector& surf_pres = *S_inter_->GetFieldData(Keys::getKey(name.str(),"pressure"), 
-								S_inter_->GetField(Keys::getKey(name.str(),"pressure"))->owner())->ViewComponent("cell", false);
+	Epetra_MultiVector& surf_pres = *S_inter_->GetFieldData(surf_pres_keys[c], 
+								S_inter_->GetField(surf_pres_keys[c])->owner())->ViewComponent("cell", false);
 	surf_pres[0][0] = surfstar_pres[0][c];
       }
       else {}
@@ -209,18 +206,15 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
       
     const Epetra_Vector& gravity = *S_->GetConstantVectorData("gravity");
     double gz = -gravity[2];
+    const std::vector<Key>& surf_pres_keys = ColumnKeys_("surface_column", "pressure");
     
     for (unsigned c=0; c<size_t; c++){
     
       double pres = vol_pd[0][c]*mdl[0][c]*gz + 101325.0; // convert volumetric head to pressure
     
       if(pres > 101325.0){
-	std::stringstream name;
-	int id = S_->GetMesh("surface")->cell_map(false).GID(c);
-	
-	name << "surface_column_" << id;
-	Epetra_MultiVector& surf_pres = *S_inter_->GetFieldData(Keys::getKey(name.str(),"pressure"), 
-								S_inter_->GetField(Keys::getKey(name.str(),"pressure"))->owner())
+	Epetra_MultiVector& surf_pres = *S_inter_->GetFieldData(surf_pres_keys[c], 
+								S_inter_->GetField(surf_pres_keys[c])->owner())
 	  ->ViewComponent("cell", false);
 	surf_pres[0][0] = pres;
       }
@@ -231,23 +225,22 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
   }
   
   //copying temperatures
+  const std::vector<Key>& surf_pres_keys = ColumnKeys_("surface_column", "pressure");
+  const std::vector<Key>& surf_temp_keys = ColumnKeys_("surface_column", "temperature");
+  const std::vector<Key>& pres_keys = ColumnKeys_("column", "pressure");
+  const std::vector<Key>& temp_keys = ColumnKeys_("column", "temperature");
   for (unsigned c=0; c<size_t; c++){
-    std::stringstream name, name_ss;
-    int id = S_->GetMesh("surface")->cell_map(false).GID(c);
-    name << "surface_column_" << id;
-    name_ss << "column_" << id;
-   
-    Epetra_MultiVector& surf_temp = *S_inter_->GetFieldData(Keys::getKey(name.str(),"temperature"), 
-							    S_inter_->GetField(Keys::getKey(name.str(),"temperature"))->owner())->ViewComponent("cell", false);
+    Epetra_MultiVector& surf_temp = *S_inter_->GetFieldData(surf_temp_keys[c], 
+							    S_inter_->GetField(surf_temp_keys[c])->owner())->ViewComponent("cell", false);
     surf_temp[0][0] = surfstar_temp[0][c];
     
-    CopySurfaceToSubsurface(*S_inter_->GetFieldData(Keys::getKey(name.str(),"pressure")),
-			    S_inter_->GetFieldData(Keys::getKey(name_ss.str(),"pressure"), 
-						   S_inter_->GetField(Keys::getKey(name_ss.str(),"pressure"))->owner()).ptr());
+    CopySurfaceToSubsurface(*S_inter_->GetFieldData(surf_pres_keys[c]),
+			    S_inter_->GetFieldData(pres_keys[c], 
+						   S_inter_->GetField(pres_keys[c])->owner()).ptr());
     
-    CopySurfaceToSubsurface(*S_inter_->GetFieldData(Keys::getKey(name.str(),"temperature")),
-			    S_inter_->GetFieldData(Keys::getKey(name_ss.str(),"temperature"), 
-						   S_inter_->GetField(Keys::getKey(name_ss.str(),"temperature"))->owner()).ptr());
+    CopySurfaceToSubsurface(*S_inter_->GetFieldData(surf_temp_keys[c]),
+			    S_inter_->GetFieldData(temp_keys[c], 
+						   S_inter_->GetField(temp_keys[c])->owner()).ptr());
   } 
   // NOTE: later do it in the setup --aj
   
@@ -415,13 +408,12 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
 							     S_inter_->GetField("surface_star-water_content")->owner())
       ->ViewComponent("cell", false);
     if (!sg_model_){
+      const std::vector<Key>& surf_p_keys = ColumnKeys_("surface_column", "pressure");
+      const std::vector<Key>& surf_wc_keys = ColumnKeys_("surface_column", "water_content");
       for (unsigned c=0; c<size_t; c++){
-	std::stringstream name;
-	int id = S_->GetMesh("surface")->cell_map(false).GID(c);
-	name << "surface_column_" << id;
-	const Epetra_MultiVector& surf_p = *S_next_->GetFieldData(Keys::getKey(name.str(),"pressure"))
+	const Epetra_MultiVector& surf_p = *S_next_->GetFieldData(surf_p_keys[c])
 	  ->ViewComponent("cell", false);
-	const Epetra_MultiVector& surf_wc = *S_next_->GetFieldData(Keys::getKey(name.str(),"water_content"))
+	const Epetra_MultiVector& surf_wc = *S_next_->GetFieldData(surf_wc_keys[c])
 	  ->ViewComponent("cell", false);
 	if(surf_p[0][0] > 101325.00){
 	  surfstar_p[0][c] = surf_p[0][0];
@@ -444,20 +436,22 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
 
       int rank;
       MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+      const std::vector<Key>& pd_keys = ColumnKeys_("surface_column", "ponded_depth");
+      const std::vector<Key>& surf_wc_keys = ColumnKeys_("surface_column", "water_content");
+      const std::vector<Key>& cv_keys = ColumnKeys_("surface_column", "cell_volume");
+      const std::vector<Key>& mdl_keys = ColumnKeys_("surface_column", "mass_density_liquid");
       
       for (unsigned c=0; c<size_t; c++){
-	std::stringstream name;
-	int id = S_->GetMesh("surface")->cell_map(false).GID(c);
-	name << "surface_column_" << id;
-	const Epetra_MultiVector& pd = *S_next_->GetFieldData(Keys::getKey(name.str(),"ponded_depth"))
+	const Epetra_MultiVector& pd = *S_next_->GetFieldData(pd_keys[c])
 	  ->ViewComponent("cell", false);
-	const Epetra_MultiVector& surf_wc = *S_next_->GetFieldData(Keys::getKey(name.str(),"water_content"))
+	const Epetra_MultiVector& surf_wc = *S_next_->GetFieldData(surf_wc_keys[c])
 	  ->ViewComponent("cell", false);
 	
-	const Epetra_MultiVector& cv = *S_next_->GetFieldData(Keys::getKey(name.str(),"cell_volume"))
+	const Epetra_MultiVector& cv = *S_next_->GetFieldData(cv_keys[c])
 	  ->ViewComponent("cell", false);
 
-	const Epetra_MultiVector& mdl = *S_next_->GetFieldData(Keys::getKey(name.str(),"mass_density_liquid"))
+	const Epetra_MultiVector& mdl = *S_next_->GetFieldData(mdl_keys[c])
 	  ->ViewComponent("cell", false);
 	
 	if (pd[0][0] >0){
@@ -487,11 +481,9 @@ WeakMPCSemiCoupled::CoupledSurfSubsurfColumns(double t_old, double t_new, bool r
       
     }
 
+    const std::vector<Key>& surf_t_keys = ColumnKeys_("surface_column", "temperature");
     for (unsigned c=0; c<size_t; c++){
-      std::stringstream name;
-      int id = S_->GetMesh("surface")->cell_map(false).GID(c);
-      name << "surface_column_" << id;
-      const Epetra_MultiVector& surf_t = *S_next_->GetFieldData(Keys::getKey(name.str(),"temperature"))->ViewComponent("cell", false);
+      const Epetra_MultiVector& surf_t = *S_next_->GetFieldData(surf_t_keys[c])->ViewComponent("cell", false);
       surfstar_t[0][c] = surf_t[0][0];
     }
 
@@ -586,7 +578,27 @@ WeakMPCSemiCoupled::CoupledSurfSubsurf3D(double t_old, double t_new, bool reinit
 };
 
 
-double 
+// Keys of a variable on each column domain, "PREFIX_GID-VAR", in order of the
+// owned surface cells.  These are fixed by the mesh, so are built once.
+const std::vector<Key>&
+WeakMPCSemiCoupled::ColumnKeys_(const std::string& prefix, const Key& var)
+{
+  std::vector<Key>& keys = col_keys_[Keys::getKey(prefix, var)];
+  if (keys.empty()) {
+    const Epetra_Map& cell_map = S_->GetMesh("surface")->cell_map(false);
+    int ncols = cell_map.NumMyElements();
+    keys.resize(ncols);
+    for (int c=0; c!=ncols; ++c) {
+      std::stringstream name;
+      name << prefix << "_" << cell_map.GID(c);
+      keys[c] = Keys::getKey(name.str(), var);
+    }
+  }
+  return keys;
+}
+
+
+double
 WeakMPCSemiCoupled::FindVolumetricHead(double d, double delta_max, double delta_ex){
 
   double a = (2*delta_ex - delta_max) / std::pow(delta_max,3);
@@ -34,6 +34,10 @@ class WeakMPCSemiCoupled : public MPC<PK> {
 
   
 private :
+  const std::vector<Key>& ColumnKeys_(const std::string& prefix, const Key& var);
+
+  std::map<Key, std::vector<Key> > col_keys_;
+
   static RegisteredPKFactory<WeakMPCSemiCoupled> reg_;
   unsigned numPKs_;
   static unsigned flag_star, flag_star_surf;
@@ -49,6 +49,8 @@ PKs.
 #include "BDF1_TI.hh"
 #include "PK_BDF.hh"
 
+#include "workspace_pool.hh"
+
 
 
 namespace Amanzi {
@@ -134,6 +136,9 @@ class PK_BDF_Default : public PK_BDF {
   // timing
   Teuchos::RCP<Teuchos::Time> step_walltime_;
 
+  // scratch vectors for residual and preconditioner evaluations
+  WorkspacePool workspace_;
+
 };
 
 } // namespace
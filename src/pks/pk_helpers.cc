@@ -92,16 +92,22 @@ applyDirichletBCs(const Operators::BCs& bcs, CompositeVector& u)
 // -----------------------------------------------------------------------------
 double
 getFaceOnBoundaryValue(AmanziMesh::Entity_ID f, const CompositeVector& u, const Operators::BCs& bcs)
+{
+  return getFaceOnBoundaryValue(f, getFaceOnBoundaryInternalCell(*u.Mesh(), f), u, bcs);
+}
+
+
+double
+getFaceOnBoundaryValue(AmanziMesh::Entity_ID f, AmanziMesh::Entity_ID c,
+                       const CompositeVector& u, const Operators::BCs& bcs)
 {
   if (u.HasComponent("face")) {
     return (*u.ViewComponent("face",false))[0][f];
   } else if (bcs.bc_model()[f] == Operators::OPERATOR_BC_DIRICHLET) {
     return bcs.bc_value()[f];
   } else {
-    auto c = getFaceOnBoundaryInternalCell(*u.Mesh(),f);
     return (*u.ViewComponent("cell",false))[0][c];
   }
-  return -1;
 }
 
 
@@ -120,5 +126,15 @@ getBoundaryDirection(const AmanziMesh::Mesh& mesh, AmanziMesh::Entity_ID f) {
 }
 
 
+// -----------------------------------------------------------------------------
+// Is the Debugger going to write anything?
+// -----------------------------------------------------------------------------
+DebuggerGate::DebuggerGate(const Teuchos::ParameterList& plist, const VerboseObject& vo) :
+    count_(0)
+{
+  active_ = (plist.isParameter("debug cells") || plist.isParameter("debug faces"))
+      && vo.getVerbLevel() >= Teuchos::VERB_HIGH;
+}
+
 
 } // namespace Amanzi
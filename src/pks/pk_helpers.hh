@@ -14,6 +14,7 @@
 #include "Mesh.hh"
 #include "CompositeVector.hh"
 #include "BCs.hh"
+#include "VerboseObject.hh"
 
 namespace Amanzi {
 
@@ -59,6 +60,11 @@ applyDirichletBCs(const Operators::BCs& bcs, CompositeVector& u);
 double
 getFaceOnBoundaryValue(AmanziMesh::Entity_ID f, const CompositeVector& u, const Operators::BCs& bcs);
 
+// As above, given the cell internal to f, e.g. from a BoundaryFacePlan.
+double
+getFaceOnBoundaryValue(AmanziMesh::Entity_ID f, AmanziMesh::Entity_ID c,
+                       const CompositeVector& u, const Operators::BCs& bcs);
+
 
 // -----------------------------------------------------------------------------
 // Get the directional int for a face that is on the boundary.
@@ -67,4 +73,32 @@ int
 getBoundaryDirection(const AmanziMesh::Mesh& mesh, AmanziMesh::Entity_ID f);
 
 
+// -----------------------------------------------------------------------------
+// Determines whether a Debugger will write anything, so that the names and
+// vectors passed to it need not be collected when it will not.  The Debugger
+// only writes for requested debug cells or faces, at high verbosity.
+//
+// Each Collect() that returns true counts a time arguments were collected.  A
+// gate is shared, by RCP, between a PK and the MPCs that use its Debugger, so
+// the count covers all of them.
+// -----------------------------------------------------------------------------
+class DebuggerGate {
+ public:
+  DebuggerGate() : active_(false), count_(0) {}
+  DebuggerGate(const Teuchos::ParameterList& plist, const VerboseObject& vo);
+
+  bool Collect() {
+    if (active_) count_++;
+    return active_;
+  }
+
+  bool active() const { return active_; }
+  int count() const { return count_; }
+
+ private:
+  bool active_;
+  int count_;
+};
+
+
 } // namespace Amanzi
@@ -10,8 +10,11 @@ Standard base for most PKs, this combines both domains/meshes of
 PKPhysicalBase and BDF methods of PK_BDF_Default.
 ------------------------------------------------------------------------- */
 
+#include <algorithm>
+
 #include "boost/math/special_functions/fpclassify.hpp"
 
+#include "face_cell_adjacency.hh"
 #include "pk_physical_bdf_default.hh"
 
 namespace Amanzi {
@@ -86,50 +89,55 @@ double PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
 
   Teuchos::RCP<const CompositeVector> dvec = res->Data();
   double h = S_next_->time() - S_inter_->time();
+  double atol = atol_, rtol = rtol_, fluxtol = fluxtol_;
+  bool locate = vo_->os_OK(Teuchos::VERB_MEDIUM);
 
-  Teuchos::RCP<const Comm_type> comm_p = mesh_->get_comm();
-  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
-    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
-  const MPI_Comm& comm = mpi_comm_p->Comm();
+  const double* cv_c = cv[0];
+  const double* conserved_c = conserved[0];
 
-  double enorm_val = 0.0;
+  std::vector<double> enorm_comps;
+  std::vector<int> enorm_locs;
   for (CompositeVector::name_iterator comp=dvec->begin();
        comp!=dvec->end(); ++comp) {
     double enorm_comp = 0.0;
     int enorm_loc = -1;
     const Epetra_MultiVector& dvec_v = *dvec->ViewComponent(*comp, false);
+    const double* dvec_e = dvec_v[0];
 
     if (*comp == "cell") {
       // error done relative to extensive, conserved quantity
       int ncells = dvec->size(*comp,false);
-      for (unsigned int c=0; c!=ncells; ++c) {
-        double enorm_c = std::abs(h * dvec_v[0][c])
-            / (atol_*cv[0][c] + rtol_*std::abs(conserved[0][c]));
-
-        if (enorm_c > enorm_comp) {
-          enorm_comp = enorm_c;
-          enorm_loc = c;
-        }
+      enorm_work_.resize(ncells);
+      double* enorm_e = enorm_work_.data();
+
+#ifdef _OPENMP
+#pragma omp simd reduction(max:enorm_comp)
+#endif
+      for (int c=0; c<ncells; ++c) {
+        enorm_e[c] = std::abs(h * dvec_e[c])
+            / (atol*cv_c[c] + rtol*std::abs(conserved_c[c]));
+        enorm_comp = enorm_e[c] > enorm_comp ? enorm_e[c] : enorm_comp;
       }
 
     } else if (*comp == std::string("face")) {
       // error in flux -- relative to cell's extensive conserved quantity
       int nfaces = dvec->size(*comp, false);
-
-      for (unsigned int f=0; f!=nfaces; ++f) {
-        AmanziMesh::Entity_ID_List cells;
-        mesh_->face_get_cells(f, AmanziMesh::Parallel_type::OWNED, &cells);
-        double cv_min = cells.size() == 1 ? cv[0][cells[0]]
-            : std::min(cv[0][cells[0]],cv[0][cells[1]]);
-        double conserved_min = cells.size() == 1 ? conserved[0][cells[0]]
-            : std::min(conserved[0][cells[0]],conserved[0][cells[1]]);
-
-        double enorm_f = fluxtol_ * h * std::abs(dvec_v[0][f])
-            / (atol_*cv_min + rtol_*std::abs(conserved_min));
-        if (enorm_f > enorm_comp) {
-          enorm_comp = enorm_f;
-          enorm_loc = f;
-        }
+      enorm_work_.resize(nfaces);
+      double* enorm_e = enorm_work_.data();
+      const Operators::FaceCellAdjacency& adj = Operators::GetFaceCellAdjacency(mesh_);
+
+#ifdef _OPENMP
+#pragma omp simd reduction(max:enorm_comp)
+#endif
+      for (int f=0; f<nfaces; ++f) {
+        int c0 = adj.owned_cell(f,0);
+        int c1 = adj.owned_cell(f,1);
+        double cv_min = std::min(cv_c[c0], cv_c[c1]);
+        double conserved_min = std::min(conserved_c[c0], conserved_c[c1]);
+
+        enorm_e[f] = fluxtol * h * std::abs(dvec_e[f])
+            / (atol*cv_min + rtol*std::abs(conserved_min));
+        enorm_comp = enorm_e[f] > enorm_comp ? enorm_e[f] : enorm_comp;
       }
 
     } else {
@@ -138,33 +146,80 @@ double PK_PhysicalBDF_Default::ErrorNorm(Teuchos::RCP<const TreeVector> u,
       //      AMANZI_ASSERT(norm < 1.e-15);
     }
 
-    // Write out Inf norms too.
-    if (vo_->os_OK(Teuchos::VERB_MEDIUM)) {
-      double infnorm(0.);
-      dvec_v.NormInf(&infnorm);
+    // the location is only needed to write it out
+    if (locate && enorm_comp > 0.) {
+      enorm_loc = std::find(enorm_work_.begin(), enorm_work_.end(), enorm_comp)
+          - enorm_work_.begin();
+    }
+    enorm_comps.push_back(enorm_comp);
+    enorm_locs.push_back(enorm_loc);
+  }
 
-      ENorm_t err;
-      ENorm_t l_err;
-      l_err.value = enorm_comp;
-      l_err.gid = dvec_v.Map().GID(enorm_loc);
+  return ReduceErrorNorms_(*dvec, enorm_comps, enorm_locs);
+};
 
-      int ierr;
 
-      ierr = MPI_Allreduce(&l_err, &err, 1, MPI_DOUBLE_INT, MPI_MAXLOC, comm);
-      AMANZI_ASSERT(!ierr);
-      *vo_->os() << "  ENorm (" << *comp << ") = " << err.value << "[" << err.gid << "] (" << infnorm << ")" << std::endl;
+// -----------------------------------------------------------------------------
+// Global reduction of per-component error norms.
+//
+// Each component contributes two (value, gid) pairs to a single MAXLOC
+// reduction: its error norm and location, and its inf norm, which is written
+// out with it.  Locations and inf norms are only filled when written.
+// -----------------------------------------------------------------------------
+double PK_PhysicalBDF_Default::ReduceErrorNorms_(const CompositeVector& dvec,
+        const std::vector<double>& enorm_comps,
+        const std::vector<int>& enorm_locs)
+{
+  bool verbose = vo_->os_OK(Teuchos::VERB_MEDIUM);
+  int ncomps = enorm_comps.size();
+
+  std::vector<ENorm_t> l_err(2*ncomps), err(2*ncomps);
+  int i = 0;
+  for (CompositeVector::name_iterator comp=dvec.begin();
+       comp!=dvec.end(); ++comp, ++i) {
+    l_err[2*i].value = enorm_comps[i];
+    l_err[2*i].gid = 0;
+    l_err[2*i+1].value = 0.;
+    l_err[2*i+1].gid = 0;
+
+    if (verbose) {
+      const Epetra_MultiVector& dvec_v = *dvec.ViewComponent(*comp, false);
+      l_err[2*i].gid = dvec_v.Map().GID(enorm_locs[i]);
+
+      double infnorm = 0.;
+      const double* dvec_e = dvec_v[0];
+      int n = dvec_v.MyLength();
+#ifdef _OPENMP
+#pragma omp simd reduction(max:infnorm)
+#endif
+      for (int j=0; j<n; ++j) {
+        double a = std::abs(dvec_e[j]);
+        infnorm = a > infnorm ? a : infnorm;
+      }
+      l_err[2*i+1].value = infnorm;
     }
-
-    enorm_val = std::max(enorm_val, enorm_comp);
   }
 
-  double enorm_val_l = enorm_val;
+  Teuchos::RCP<const Comm_type> comm_p = mesh_->get_comm();
+  Teuchos::RCP<const MpiComm_type> mpi_comm_p =
+    Teuchos::rcp_dynamic_cast<const MpiComm_type>(comm_p);
+  const MPI_Comm& comm = mpi_comm_p->Comm();
 
-  int ierr;
-  ierr = MPI_Allreduce(&enorm_val_l, &enorm_val, 1, MPI_DOUBLE, MPI_MAX, comm);
+  int ierr = MPI_Allreduce(l_err.data(), err.data(), 2*ncomps, MPI_DOUBLE_INT, MPI_MAXLOC, comm);
   AMANZI_ASSERT(!ierr);
+
+  double enorm_val = 0.0;
+  i = 0;
+  for (CompositeVector::name_iterator comp=dvec.begin();
+       comp!=dvec.end(); ++comp, ++i) {
+    if (verbose) {
+      *vo_->os() << "  ENorm (" << *comp << ") = " << err[2*i].value << "[" << err[2*i].gid
+                 << "] (" << err[2*i+1].value << ")" << std::endl;
+    }
+    enorm_val = std::max(enorm_val, err[2*i].value);
+  }
   return enorm_val;
-};
+}
 
 
   // void PK_PhysicalBDF_Default::Solution_to_State(TreeVector& solution,
@@ -132,11 +132,21 @@ class PK_PhysicalBDF_Default : public PK_BDF_Default,
   // BCs
   Teuchos::RCP<Operators::BCs> bc_;
 
+  // Reduces the local error norms of each component of dvec, and their local
+  // IDs, globally.  A single reduction carries all components along with what
+  // is written out when verbose.  Returns the max over components.
+  double ReduceErrorNorms_(const CompositeVector& dvec,
+                           const std::vector<double>& enorm_comps,
+                           const std::vector<int>& enorm_locs);
+
   // error criteria
   Key conserved_key_;
   Key cell_vol_key_;
   double atol_, rtol_, fluxtol_;
 
+  // work space for per-entity error norms
+  std::vector<double> enorm_work_;
+
 };
 
 
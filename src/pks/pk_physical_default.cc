@@ -38,6 +38,18 @@ PK_Physical_Default::PK_Physical_Default(Teuchos::ParameterList& pk_tree,
   vo_ = Teuchos::rcp(new VerboseObject(*S->GetMesh(domain_)->get_comm(), name_, *plist_));
 }
 
+
+// Report how often debugger output was collected over the run.
+PK_Physical_Default::~PK_Physical_Default()
+{
+  if (db_gate_ != Teuchos::null && db_gate_->active()
+      && vo_->os_OK(Teuchos::VERB_EXTREME)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "Debugger output collected " << db_gate_->count()
+               << " times." << std::endl;
+  }
+}
+
 // -----------------------------------------------------------------------------
 // Construction of data.
 // -----------------------------------------------------------------------------
@@ -50,6 +62,7 @@ void PK_Physical_Default::Setup(const Teuchos::Ptr<State>& S) {
 
   // set up the debugger
   db_ = Teuchos::rcp(new Debugger(mesh_, name_, *plist_));
+  db_gate_ = Teuchos::rcp(new DebuggerGate(*plist_, *vo_));
 
   // require primary variable evaluator
   S->RequireFieldEvaluator(key_);
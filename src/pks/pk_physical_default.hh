@@ -48,6 +48,7 @@ all leaves of the PK tree will inherit from `PKPhysicalBase`.
 #include "primary_variable_field_evaluator.hh"
 #include "PK.hh"
 #include "PK_Physical.hh"
+#include "pk_helpers.hh"
 
 namespace Amanzi {
 
@@ -60,7 +61,7 @@ class PK_Physical_Default : public PK_Physical {
                         const Teuchos::RCP<TreeVector>& solution);
 
   // Virtual destructor
-  virtual ~PK_Physical_Default() = default;
+  virtual ~PK_Physical_Default();
 
   // Default implementations of PK methods.
   // -- transfer operators -- pointer copies only
@@ -88,7 +89,12 @@ class PK_Physical_Default : public PK_Physical {
   // -- initialize
   virtual void Initialize(const Teuchos::Ptr<State>& S);
 
+  // -- will the debugger write anything?
+  Teuchos::RCP<DebuggerGate> debugger_gate() { return db_gate_; }
+
  protected: // data
+  // skip collecting debugger output when it is not written
+  Teuchos::RCP<DebuggerGate> db_gate_;
 
   // step validity
   double max_valid_change_;
@@ -0,0 +1,89 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! A policy for reusing an assembled preconditioner across iterations and timesteps.
+
+#include "preconditioner_reuse.hh"
+
+namespace Amanzi {
+
+PreconditionerReuse::PreconditionerReuse() :
+    enabled_(false),
+    max_dt_ratio_(1.5),
+    max_contraction_(0.5),
+    max_reuses_(20),
+    built_(false),
+    reused_(false),
+    h_built_(0.),
+    newton_built_(false),
+    reuses_(0),
+    t_norm_(-1.),
+    last_norm_(-1.),
+    contraction_(0.),
+    n_builds_(0),
+    n_reuses_(0),
+    its_built_(0),
+    its_reused_(0) {}
+
+
+PreconditionerReuse::PreconditionerReuse(Teuchos::ParameterList& plist) :
+    PreconditionerReuse()
+{
+  enabled_ = plist.get<bool>("reuse preconditioner", false);
+  max_dt_ratio_ = plist.get<double>("maximum timestep ratio", 1.5);
+  max_contraction_ = plist.get<double>("maximum contraction", 0.5);
+  max_reuses_ = plist.get<int>("maximum reuses", 20);
+}
+
+
+bool PreconditionerReuse::Rebuild(double h, bool newton)
+{
+  bool rebuild = !enabled_ || !built_
+      || newton != newton_built_
+      || reuses_ >= max_reuses_
+      || h > max_dt_ratio_ * h_built_
+      || h_built_ > max_dt_ratio_ * h
+      || contraction_ > max_contraction_;
+
+  if (rebuild) {
+    built_ = true;
+    h_built_ = h;
+    newton_built_ = newton;
+    reuses_ = 0;
+    contraction_ = 0.;
+    n_builds_++;
+  } else {
+    reuses_++;
+    n_reuses_++;
+  }
+  reused_ = !rebuild;
+  return rebuild;
+}
+
+
+void PreconditionerReuse::RecordErrorNorm(double t, double enorm)
+{
+  if (t != t_norm_) {
+    t_norm_ = t;
+    last_norm_ = -1.;
+  }
+  if (last_norm_ > 0.) contraction_ = enorm / last_norm_;
+  last_norm_ = enorm;
+
+  if (reused_) its_reused_++;
+  else its_built_++;
+}
+
+
+void PreconditionerReuse::WriteStatistics(std::ostream& os) const
+{
+  os << "preconditioner: " << n_builds_ << " builds, " << n_reuses_
+     << " reuses; nonlinear iterations with new/reused preconditioner: "
+     << its_built_ << "/" << its_reused_ << std::endl;
+}
+
+} // namespace
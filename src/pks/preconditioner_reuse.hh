@@ -0,0 +1,105 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! A policy for reusing an assembled preconditioner across iterations and timesteps.
+
+/*!
+
+Assembling the preconditioner is often a large fraction of the cost of a
+nonlinear iteration.  When the solution varies slowly, the preconditioner from
+a previous iteration, or even a previous timestep, is nearly as effective as a
+new one.  This policy keeps the assembled preconditioner and only asks for a
+rebuild when:
+
+- the timestep size has changed by more than a given factor since the last
+  assembly (the accumulation terms scale with 1/h),
+- the nonlinear iteration is contracting slowly, measured by the ratio of
+  successive error norms, or
+- the preconditioner has been reused a maximum number of times, or
+- a Newton correction, lagged a number of iterations, is now due but was not
+  included when the preconditioner was assembled (or vice versa).
+
+The PK that owns the assembled preconditioner should set this policy; PKs
+whose preconditioners are blocks of a coupler's preconditioner should leave it
+disabled.
+
+.. _preconditioner-reuse-spec:
+.. admonition:: preconditioner-reuse-spec
+
+    * `"reuse preconditioner`" ``[bool]`` **false** Turn on reuse.
+
+    * `"maximum timestep ratio`" ``[double]`` **1.5** Rebuild if the
+      timestep is larger or smaller than that of the last assembly by more
+      than this factor.
+
+    * `"maximum contraction`" ``[double]`` **0.5** Rebuild if the ratio of
+      successive nonlinear error norms is larger than this.
+
+    * `"maximum reuses`" ``[int]`` **20** Rebuild after this many consecutive
+      reuses.
+
+*/
+
+#ifndef ATS_PRECONDITIONER_REUSE_HH_
+#define ATS_PRECONDITIONER_REUSE_HH_
+
+#include <ostream>
+
+#include "Teuchos_ParameterList.hpp"
+
+namespace Amanzi {
+
+class PreconditionerReuse {
+
+ public:
+  // default is disabled, always rebuilding
+  PreconditionerReuse();
+  explicit PreconditionerReuse(Teuchos::ParameterList& plist);
+
+  // Decide whether the preconditioner must be rebuilt for a step of size h.
+  // newton is whether a preconditioner assembled now would include the
+  // Newton correction.  The decision is counted in the statistics.
+  bool Rebuild(double h, bool newton=false);
+
+  // Record the error norm of a nonlinear iterate at time t.  A change in t
+  // indicates a new nonlinear solve.
+  void RecordErrorNorm(double t, double enorm);
+
+  // Force a rebuild at the next call.
+  void Invalidate() { built_ = false; }
+
+  bool enabled() const { return enabled_; }
+  void WriteStatistics(std::ostream& os) const;
+
+ private:
+  bool enabled_;
+  double max_dt_ratio_;
+  double max_contraction_;
+  int max_reuses_;
+
+  // state of the current preconditioner
+  bool built_;
+  bool reused_;
+  double h_built_;
+  bool newton_built_;
+  int reuses_;
+
+  // nonlinear convergence monitoring
+  double t_norm_;
+  double last_norm_;
+  double contraction_;
+
+  // statistics
+  int n_builds_;
+  int n_reuses_;
+  int its_built_;
+  int its_reused_;
+};
+
+} // namespace
+
+#endif
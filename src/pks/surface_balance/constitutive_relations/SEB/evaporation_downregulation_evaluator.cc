@@ -75,14 +75,14 @@ Teuchos::RCP<const CompositeVector> pot_evap = S->GetFieldData(pot_evap_key_);
 
   for (CompositeVector::name_iterator comp=result->begin();
        comp!=result->end(); ++comp) {
-    const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-    const Epetra_MultiVector& poro_v = *poro->ViewComponent(*comp, false);
-    const Epetra_MultiVector& pot_evap_v = *pot_evap->ViewComponent(*comp, false);
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+    const double* __restrict sg_v = (*sg->ViewComponent(*comp, false))[0];
+    const double* __restrict poro_v = (*poro->ViewComponent(*comp, false))[0];
+    const double* __restrict pot_evap_v = (*pot_evap->ViewComponent(*comp, false))[0];
+    double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
     int ncomp = result->size(*comp, false);
     for (int i=0; i!=ncomp; ++i) {
-      result_v[0][i] = model_->Evaporation(sg_v[0][i], poro_v[0][i], pot_evap_v[0][i]);
+      result_v[i] = model_->Evaporation(sg_v[i], poro_v[i], pot_evap_v[i]);
     }
   }
 }
@@ -99,42 +99,42 @@ Teuchos::RCP<const CompositeVector> pot_evap = S->GetFieldData(pot_evap_key_);
   if (wrt_key == sg_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& poro_v = *poro->ViewComponent(*comp, false);
-      const Epetra_MultiVector& pot_evap_v = *pot_evap->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* __restrict poro_v = (*poro->ViewComponent(*comp, false))[0];
+      const double* __restrict pot_evap_v = (*pot_evap->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEvaporationDSaturationGas(sg_v[0][i], poro_v[0][i], pot_evap_v[0][i]);
+        result_v[i] = model_->DEvaporationDSaturationGas(sg_v[i], poro_v[i], pot_evap_v[i]);
       }
     }
 
   } else if (wrt_key == poro_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& poro_v = *poro->ViewComponent(*comp, false);
-      const Epetra_MultiVector& pot_evap_v = *pot_evap->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* __restrict poro_v = (*poro->ViewComponent(*comp, false))[0];
+      const double* __restrict pot_evap_v = (*pot_evap->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEvaporationDPorosity(sg_v[0][i], poro_v[0][i], pot_evap_v[0][i]);
+        result_v[i] = model_->DEvaporationDPorosity(sg_v[i], poro_v[i], pot_evap_v[i]);
       }
     }
 
   } else if (wrt_key == pot_evap_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& sg_v = *sg->ViewComponent(*comp, false);
-      const Epetra_MultiVector& poro_v = *poro->ViewComponent(*comp, false);
-      const Epetra_MultiVector& pot_evap_v = *pot_evap->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict sg_v = (*sg->ViewComponent(*comp, false))[0];
+      const double* __restrict poro_v = (*poro->ViewComponent(*comp, false))[0];
+      const double* __restrict pot_evap_v = (*pot_evap->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DEvaporationDPotentialEvaporation(sg_v[0][i], poro_v[0][i], pot_evap_v[0][i]);
+        result_v[i] = model_->DEvaporationDPotentialEvaporation(sg_v[i], poro_v[i], pot_evap_v[i]);
       }
     }
 
@@ -11,7 +11,6 @@ Downregulates evaporation from a potential.
 #include "Teuchos_ParameterList.hpp"
 #include "dbc.hh"
 #include "evaporation_downregulation_model.hh"
-#include "seb_physics_funcs.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -33,31 +32,6 @@ EvaporationDownregulationModel::InitializeFromPlist_(Teuchos::ParameterList& pli
 }
 
 
-// main method
-double
-EvaporationDownregulationModel::Evaporation(double sg, double poro, double pot_evap) const
-{
-  return pot_evap / (1. + SEBPhysics::EvaporativeResistanceCoef(sg, poro, dess_dz_, Clapp_Horn_b_));
-}
-
-double
-EvaporationDownregulationModel::DEvaporationDSaturationGas(double sg, double poro, double pot_evap) const
-{
-  return 0.;
-}
-
-double
-EvaporationDownregulationModel::DEvaporationDPorosity(double sg, double poro, double pot_evap) const
-{
-  return 0.;
-}
-
-double
-EvaporationDownregulationModel::DEvaporationDPotentialEvaporation(double sg, double poro, double pot_evap) const
-{
-  return 1. / (1. + SEBPhysics::EvaporativeResistanceCoef(sg, poro, dess_dz_, Clapp_Horn_b_));
-}
-
 } //namespace
 } //namespace
 } //namespace
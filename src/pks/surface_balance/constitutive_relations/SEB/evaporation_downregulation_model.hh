@@ -11,6 +11,10 @@ Downregulates evaporation from a potential.
 #ifndef AMANZI_SEB_EVAPORATION_DOWNREGULATION_MODEL_HH_
 #define AMANZI_SEB_EVAPORATION_DOWNREGULATION_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+#include "seb_physics_funcs.hh"
+
 namespace Amanzi {
 namespace SurfaceBalance {
 namespace Relations {
@@ -37,6 +41,34 @@ class EvaporationDownregulationModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+EvaporationDownregulationModel::Evaporation(double sg, double poro, double pot_evap) const
+{
+  return pot_evap / (1. + SEBPhysics::EvaporativeResistanceCoef(sg, poro, dess_dz_, Clapp_Horn_b_));
+}
+
+inline double
+EvaporationDownregulationModel::DEvaporationDSaturationGas(double sg, double poro, double pot_evap) const
+{
+  return 0.;
+}
+
+inline double
+EvaporationDownregulationModel::DEvaporationDPorosity(double sg, double poro, double pot_evap) const
+{
+  return 0.;
+}
+
+inline double
+EvaporationDownregulationModel::DEvaporationDPotentialEvaporation(double sg, double poro, double pot_evap) const
+{
+  return 1. / (1. + SEBPhysics::EvaporativeResistanceCoef(sg, poro, dess_dz_, Clapp_Horn_b_));
+}
+
 } //namespace
 } //namespace
 } //namespace
@@ -37,6 +37,8 @@ https://github.com/landlab/landlab/blob/master/landlab/components/radiation/radi
 
 */
 
+#include <limits>
+
 #include "incident_shortwave_radiation_evaluator.hh"
 #include "incident_shortwave_radiation_model.hh"
 
@@ -94,6 +96,32 @@ IncidentShortwaveRadiationEvaluator::InitializeFromPlist_()
 }
 
 
+// Slope and aspect trigonometry of each entry of a component, recomputed
+// only where slope or aspect have changed, i.e. on deforming meshes.
+const std::vector<SlopeAspectTrig>&
+IncidentShortwaveRadiationEvaluator::SlopeAspectTrig_(const std::string& comp,
+        const Epetra_MultiVector& slope, const Epetra_MultiVector& aspect)
+{
+  TrigCache& cache = trig_[comp];
+  int ncomp = slope.MyLength();
+  if ((int) cache.trig.size() != ncomp) {
+    // NaN compares unequal to everything, forcing the first computation
+    cache.slope.assign(ncomp, std::numeric_limits<double>::quiet_NaN());
+    cache.aspect.assign(ncomp, std::numeric_limits<double>::quiet_NaN());
+    cache.trig.resize(ncomp);
+  }
+
+  for (int i=0; i!=ncomp; ++i) {
+    if (slope[0][i] != cache.slope[i] || aspect[0][i] != cache.aspect[i]) {
+      cache.slope[i] = slope[0][i];
+      cache.aspect[i] = aspect[0][i];
+      cache.trig[i] = IncidentShortwaveRadiationModel::ComputeSlopeAspectTrig(slope[0][i], aspect[0][i]);
+    }
+  }
+  return cache.trig;
+}
+
+
 void
 IncidentShortwaveRadiationEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
         const Teuchos::Ptr<CompositeVector>& result)
@@ -101,18 +129,18 @@ IncidentShortwaveRadiationEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S
   Teuchos::RCP<const CompositeVector> slope = S->GetFieldData(slope_key_);
   Teuchos::RCP<const CompositeVector> aspect = S->GetFieldData(aspect_key_);
   Teuchos::RCP<const CompositeVector> qSWin = S->GetFieldData(qSWin_key_);
+  SolarGeometry geom = model_->ComputeSolarGeometry(S->time());
 
   for (CompositeVector::name_iterator comp=result->begin();
        comp!=result->end(); ++comp) {
-    const Epetra_MultiVector& slope_v = *slope->ViewComponent(*comp, false);
-    const Epetra_MultiVector& aspect_v = *aspect->ViewComponent(*comp, false);
+    const std::vector<SlopeAspectTrig>& trig = SlopeAspectTrig_(*comp,
+            *slope->ViewComponent(*comp, false), *aspect->ViewComponent(*comp, false));
     const Epetra_MultiVector& qSWin_v = *qSWin->ViewComponent(*comp, false);
     Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
-    double time = S->time();
 
     int ncomp = result->size(*comp, false);
     for (int i=0; i!=ncomp; ++i) {
-      result_v[0][i] = model_->IncidentShortwaveRadiation(slope_v[0][i], aspect_v[0][i], qSWin_v[0][i], time);
+      result_v[0][i] = model_->IncidentShortwaveRadiation(geom, trig[i], qSWin_v[0][i]);
     }
   }
 }
@@ -125,52 +153,31 @@ IncidentShortwaveRadiationEvaluator::EvaluateFieldPartialDerivative_(const Teuch
   Teuchos::RCP<const CompositeVector> slope = S->GetFieldData(slope_key_);
   Teuchos::RCP<const CompositeVector> aspect = S->GetFieldData(aspect_key_);
   Teuchos::RCP<const CompositeVector> qSWin = S->GetFieldData(qSWin_key_);
-  double time = S->time();
+  SolarGeometry geom = model_->ComputeSolarGeometry(S->time());
 
-  if (wrt_key == slope_key_) {
-    for (CompositeVector::name_iterator comp=result->begin();
-         comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& slope_v = *slope->ViewComponent(*comp, false);
-      const Epetra_MultiVector& aspect_v = *aspect->ViewComponent(*comp, false);
-      const Epetra_MultiVector& qSWin_v = *qSWin->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+  for (CompositeVector::name_iterator comp=result->begin();
+       comp!=result->end(); ++comp) {
+    const std::vector<SlopeAspectTrig>& trig = SlopeAspectTrig_(*comp,
+            *slope->ViewComponent(*comp, false), *aspect->ViewComponent(*comp, false));
+    const Epetra_MultiVector& qSWin_v = *qSWin->ViewComponent(*comp, false);
+    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
 
-      int ncomp = result->size(*comp, false);
+    int ncomp = result->size(*comp, false);
+    if (wrt_key == slope_key_) {
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DIncidentShortwaveRadiationDSlope(slope_v[0][i], aspect_v[0][i], qSWin_v[0][i], time);
+        result_v[0][i] = model_->DIncidentShortwaveRadiationDSlope(geom, trig[i], qSWin_v[0][i]);
       }
-    }
-
-  } else if (wrt_key == aspect_key_) {
-    for (CompositeVector::name_iterator comp=result->begin();
-         comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& slope_v = *slope->ViewComponent(*comp, false);
-      const Epetra_MultiVector& aspect_v = *aspect->ViewComponent(*comp, false);
-      const Epetra_MultiVector& qSWin_v = *qSWin->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
-
-      int ncomp = result->size(*comp, false);
+    } else if (wrt_key == aspect_key_) {
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DIncidentShortwaveRadiationDAspect(slope_v[0][i], aspect_v[0][i], qSWin_v[0][i], time);
+        result_v[0][i] = model_->DIncidentShortwaveRadiationDAspect(geom, trig[i], qSWin_v[0][i]);
       }
-    }
-
-  } else if (wrt_key == qSWin_key_) {
-    for (CompositeVector::name_iterator comp=result->begin();
-         comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& slope_v = *slope->ViewComponent(*comp, false);
-      const Epetra_MultiVector& aspect_v = *aspect->ViewComponent(*comp, false);
-      const Epetra_MultiVector& qSWin_v = *qSWin->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
-
-      int ncomp = result->size(*comp, false);
+    } else if (wrt_key == qSWin_key_) {
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DIncidentShortwaveRadiationDIncomingShortwaveRadiation(slope_v[0][i], aspect_v[0][i], qSWin_v[0][i], time);
+        result_v[0][i] = model_->DIncidentShortwaveRadiationDIncomingShortwaveRadiation(geom, trig[i], qSWin_v[0][i]);
       }
+    } else {
+      AMANZI_ASSERT(false);
     }
-
-  } else {
-    AMANZI_ASSERT(false);
   }
 }
 
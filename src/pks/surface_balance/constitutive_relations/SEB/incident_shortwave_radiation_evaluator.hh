@@ -28,15 +28,17 @@ https://github.com/landlab/landlab/blob/master/landlab/components/radiation/radi
 
 #pragma once
 
+#include <map>
+#include <vector>
+
 #include "Factory.hh"
 #include "secondary_variable_field_evaluator.hh"
+#include "incident_shortwave_radiation_model.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
 namespace Relations {
 
-class IncidentShortwaveRadiationModel;
-
 class IncidentShortwaveRadiationEvaluator : public SecondaryVariableFieldEvaluator {
 
  public:
@@ -57,12 +59,23 @@ class IncidentShortwaveRadiationEvaluator : public SecondaryVariableFieldEvaluat
  protected:
   void InitializeFromPlist_();
 
+  const std::vector<SlopeAspectTrig>&
+  SlopeAspectTrig_(const std::string& comp, const Epetra_MultiVector& slope,
+                   const Epetra_MultiVector& aspect);
+
   Key slope_key_;
   Key aspect_key_;
   Key qSWin_key_;
 
   Teuchos::RCP<IncidentShortwaveRadiationModel> model_;
 
+  // slope, aspect, and their trigonometry at the last evaluation
+  struct TrigCache {
+    std::vector<double> slope, aspect;
+    std::vector<SlopeAspectTrig> trig;
+  };
+  std::map<std::string, TrigCache> trig_;
+
  private:
   static Utils::RegisteredFactory<FieldEvaluator,IncidentShortwaveRadiationEvaluator> reg_;
 
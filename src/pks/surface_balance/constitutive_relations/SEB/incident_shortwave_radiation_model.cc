@@ -61,6 +61,36 @@ IncidentShortwaveRadiationModel::InitializeFromPlist_(Teuchos::ParameterList& pl
 // main method
 double
 IncidentShortwaveRadiationModel::IncidentShortwaveRadiation(double slope, double aspect, double qSWin, double time) const
+{
+  return IncidentShortwaveRadiation(ComputeSolarGeometry(time),
+          ComputeSlopeAspectTrig(slope, aspect), qSWin);
+}
+
+double
+IncidentShortwaveRadiationModel::DIncidentShortwaveRadiationDSlope(double slope, double aspect, double qSWin, double time) const
+{
+  return DIncidentShortwaveRadiationDSlope(ComputeSolarGeometry(time),
+          ComputeSlopeAspectTrig(slope, aspect), qSWin);
+}
+
+double
+IncidentShortwaveRadiationModel::DIncidentShortwaveRadiationDAspect(double slope, double aspect, double qSWin, double time) const
+{
+  return DIncidentShortwaveRadiationDAspect(ComputeSolarGeometry(time),
+          ComputeSlopeAspectTrig(slope, aspect), qSWin);
+}
+
+double
+IncidentShortwaveRadiationModel::DIncidentShortwaveRadiationDIncomingShortwaveRadiation(double slope, double aspect, double qSWin, double time) const
+{
+  return DIncidentShortwaveRadiationDIncomingShortwaveRadiation(ComputeSolarGeometry(time),
+          ComputeSlopeAspectTrig(slope, aspect), qSWin);
+}
+
+
+// Sun positions used at a given time.
+SolarGeometry
+IncidentShortwaveRadiationModel::ComputeSolarGeometry(double time) const
 {
   double time_days = time / 86400.0;
   double doy = std::fmod((double)doy0_ + time_days, (double)365);
@@ -72,52 +102,114 @@ IncidentShortwaveRadiationModel::IncidentShortwaveRadiation(double slope, double
     doy = doy - 365.0;
   }
 
-  double rad = 0.0;
+  SolarGeometry geom;
+  geom.weight[0] = 1.;
   if (daily_avg_) {
     double hour = 12;
     // to keep this function smooth, we interpolate between neighboring days
+    int doy_ii;
     if (doy_i < doy) {
-      double rad_i = Impl::Radiation(slope, aspect, doy_i, hour, lat_, qSWin);
-      int doy_ii = doy_i + 1;
+      doy_ii = doy_i + 1;
       if (doy_ii > 364) doy_ii = 0;
-      double rad_ii = Impl::Radiation(slope, aspect, doy_ii, hour, lat_, qSWin);
-      rad = rad_i + (doy - doy_i) * rad_ii;
+      geom.weight[1] = doy - doy_i;
     } else {
-      double rad_i = Impl::Radiation(slope, aspect, doy_i, hour, lat_, qSWin);
-      int doy_ii = doy_i - 1;
+      doy_ii = doy_i - 1;
       if (doy_ii < 0) doy_ii = 364;
-      double rad_ii = Impl::Radiation(slope, aspect, doy_ii, hour, lat_, qSWin);
-      rad = rad_i + (doy_i - doy) * rad_ii;
+      geom.weight[1] = doy_i - doy;
     }
+    geom.n = 2;
+    Impl::SunPosition(doy_i, hour, lat_, geom.cot_cos[0], geom.cot_sin[0]);
+    Impl::SunPosition(doy_ii, hour, lat_, geom.cot_cos[1], geom.cot_sin[1]);
   } else {
     double hour = 12.0 + 24 * (doy - doy_i);
-    rad = Impl::Radiation(slope, aspect, doy_i, hour, lat_, qSWin);
+    geom.n = 1;
+    Impl::SunPosition(doy_i, hour, lat_, geom.cot_cos[0], geom.cot_sin[0]);
   }
-  if (qSWin > 200) {
-    std::cout << "slope = " << slope << ", aspect = " << aspect << ", doy = " << doy_i << " qSWin = " << qSWin << ", rad = " << rad << std::endl;
+  return geom;
+}
+
+
+SlopeAspectTrig
+IncidentShortwaveRadiationModel::ComputeSlopeAspectTrig(double slope, double aspect)
+{
+  // theta = atan(slope)
+  SlopeAspectTrig trig;
+  double r = 1.0 / std::sqrt(1.0 + slope*slope);
+  trig.cos_theta = r;
+  trig.sin_theta = slope * r;
+  trig.dtheta_dslope = r*r;
+  trig.cos_aspect = std::cos(aspect);
+  trig.sin_aspect = std::sin(aspect);
+  return trig;
+}
+
+
+// The aspect modifier of sun position k, and whether it is within the
+// limits, outside of which it does not depend on slope or aspect.
+static bool
+AspectModifier(const SolarGeometry& geom, int k, const SlopeAspectTrig& trig, double& fac)
+{
+  fac = trig.cos_theta + trig.sin_theta *
+      (geom.cot_cos[k] * trig.cos_aspect + geom.cot_sin[k] * trig.sin_aspect);
+  if (fac > 6.) {
+    fac = 6.;
+    return false;
+  } else if (fac < 0.) {
+    fac = 0.;
+    return false;
   }
+  return true;
+}
 
-  return rad;
+
+double
+IncidentShortwaveRadiationModel::IncidentShortwaveRadiation(const SolarGeometry& geom,
+        const SlopeAspectTrig& trig, double qSWin) const
+{
+  return qSWin * DIncidentShortwaveRadiationDIncomingShortwaveRadiation(geom, trig, qSWin);
 }
 
 double
-IncidentShortwaveRadiationModel::DIncidentShortwaveRadiationDSlope(double slope, double aspect, double qSWin, double time) const
+IncidentShortwaveRadiationModel::DIncidentShortwaveRadiationDSlope(const SolarGeometry& geom,
+        const SlopeAspectTrig& trig, double qSWin) const
 {
-  AMANZI_ASSERT(false);
-  return 0;
+  double dfac = 0.;
+  for (int k=0; k!=geom.n; ++k) {
+    double fac;
+    if (AspectModifier(geom, k, trig, fac)) {
+      double cos_dphi = geom.cot_cos[k] * trig.cos_aspect + geom.cot_sin[k] * trig.sin_aspect;
+      dfac += geom.weight[k] * (-trig.sin_theta + trig.cos_theta * cos_dphi);
+    }
+  }
+  return qSWin * dfac * trig.dtheta_dslope;
 }
 
 double
-IncidentShortwaveRadiationModel::DIncidentShortwaveRadiationDAspect(double slope, double aspect, double qSWin, double time) const
+IncidentShortwaveRadiationModel::DIncidentShortwaveRadiationDAspect(const SolarGeometry& geom,
+        const SlopeAspectTrig& trig, double qSWin) const
 {
-  AMANZI_ASSERT(false);
-  return 0;
+  double dfac = 0.;
+  for (int k=0; k!=geom.n; ++k) {
+    double fac;
+    if (AspectModifier(geom, k, trig, fac)) {
+      double sin_dphi = geom.cot_sin[k] * trig.cos_aspect - geom.cot_cos[k] * trig.sin_aspect;
+      dfac += geom.weight[k] * trig.sin_theta * sin_dphi;
+    }
+  }
+  return qSWin * dfac;
 }
 
 double
-IncidentShortwaveRadiationModel::DIncidentShortwaveRadiationDIncomingShortwaveRadiation(double slope, double aspect, double qSWin, double time) const
+IncidentShortwaveRadiationModel::DIncidentShortwaveRadiationDIncomingShortwaveRadiation(const SolarGeometry& geom,
+        const SlopeAspectTrig& trig, double qSWin) const
 {
-  return IncidentShortwaveRadiation(slope, aspect, qSWin, time) / qSWin;
+  double fac_sum = 0.;
+  for (int k=0; k!=geom.n; ++k) {
+    double fac;
+    AspectModifier(geom, k, trig, fac);
+    fac_sum += geom.weight[k] * fac;
+  }
+  return fac_sum;
 }
 
 namespace Impl {  
@@ -328,6 +420,36 @@ double Radiation(double slope, double aspect, int doy, double hour, double lat,
   return qSWin * fac;
 }
 
+/*Time-dependent terms of the aspect modifier
+
+    Parameters
+    ----------
+    doy : int
+      Julian day of the year
+    hour : double
+      Hour of the day, in 24-hour clock [0,24)
+    lat : double
+      Latitude [degrees]
+
+    Returns
+    -------
+    cot_cos, cot_sin : double
+      cot(alpha) * cos(phi_sun) and cot(alpha) * sin(phi_sun), for alpha the
+      solar altitude and phi_sun the sun's azhimuth.
+*/
+void SunPosition(int doy, double hour, double lat, double& cot_cos, double& cot_sin)
+{
+  double delta = DeclinationAngle(doy);
+  double lat_r = M_PI / 180. * lat;
+  double tau = HourAngle(hour);
+
+  double alpha = SolarAltitude(delta,lat_r,tau);
+  double phi_sun = SolarAzhimuth(delta,lat_r,tau);
+  double cot_alpha = std::cos(alpha) / FlatGeometry(alpha, phi_sun);
+  cot_cos = cot_alpha * std::cos(phi_sun);
+  cot_sin = cot_alpha * std::sin(phi_sun);
+}
+
 } //namespace Impl
 } //namespace Relations
 } //namespace SurfaceBalance
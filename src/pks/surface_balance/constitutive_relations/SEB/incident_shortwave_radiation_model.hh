@@ -37,6 +37,8 @@ https://github.com/landlab/landlab/blob/master/landlab/components/radiation/radi
 #ifndef AMANZI_SURFACEBALANCE_INCIDENT_SHORTWAVE_RADIATION_MODEL_HH_
 #define AMANZI_SURFACEBALANCE_INCIDENT_SHORTWAVE_RADIATION_MODEL_HH_
 
+#include <utility>
+
 namespace Amanzi {
 namespace SurfaceBalance {
 namespace Relations {
@@ -50,8 +52,31 @@ namespace Impl {
   double SlopeGeometry(double slope, double aspect, double alpha, double phi_sun);
   std::pair<double,double> GeometricRadiationFactors(double slope, double aspect, int doy, double hour, double lat);
   double Radiation(double slope, double aspect, int doy, double hr, double lat, double qSWin);
+  void SunPosition(int doy, double hour, double lat, double& cot_cos, double& cot_sin);
 }
-  
+
+
+// The aspect modifier of a sun position is
+//
+//   cos(theta) + sin(theta) * cot(alpha) * cos(phi_sun - aspect),
+//
+// limited to [0,6], where theta = atan(slope) and alpha, phi_sun are the
+// solar altitude and azimuth.  The result is a weighted sum over one or two
+// sun positions, all of which depend only on time and latitude.
+struct SolarGeometry {
+  int n;
+  double weight[2];
+  double cot_cos[2];  // cot(alpha) * cos(phi_sun)
+  double cot_sin[2];  // cot(alpha) * sin(phi_sun)
+};
+
+// Slope and aspect terms of a cell, which depend only on the mesh.
+struct SlopeAspectTrig {
+  double cos_theta, sin_theta;
+  double dtheta_dslope;
+  double cos_aspect, sin_aspect;
+};
+
 
 class IncidentShortwaveRadiationModel {
 
@@ -64,6 +89,16 @@ class IncidentShortwaveRadiationModel {
   double DIncidentShortwaveRadiationDSlope(double slope, double aspect, double qSWin, double time) const;
   double DIncidentShortwaveRadiationDAspect(double slope, double aspect, double qSWin, double time) const;
   double DIncidentShortwaveRadiationDIncomingShortwaveRadiation(double slope, double aspect, double qSWin, double time) const;
+
+  // Versions of the above for loops over cells, which compute the
+  // geometry once per time and the trigonometry once per cell.
+  SolarGeometry ComputeSolarGeometry(double time) const;
+  static SlopeAspectTrig ComputeSlopeAspectTrig(double slope, double aspect);
+
+  double IncidentShortwaveRadiation(const SolarGeometry& geom, const SlopeAspectTrig& trig, double qSWin) const;
+  double DIncidentShortwaveRadiationDSlope(const SolarGeometry& geom, const SlopeAspectTrig& trig, double qSWin) const;
+  double DIncidentShortwaveRadiationDAspect(const SolarGeometry& geom, const SlopeAspectTrig& trig, double qSWin) const;
+  double DIncidentShortwaveRadiationDIncomingShortwaveRadiation(const SolarGeometry& geom, const SlopeAspectTrig& trig, double qSWin) const;
   
  protected:
   void InitializeFromPlist_(Teuchos::ParameterList& plist);
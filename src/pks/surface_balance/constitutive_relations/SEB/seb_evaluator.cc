@@ -249,6 +249,7 @@ SEBEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
   }
 
   unsigned int ncells = mass_source.MyLength();
+  snow_patches_.clear();
   for (unsigned int c=0; c!=ncells; ++c) {
     // get the top cell
     AmanziMesh::Entity_ID subsurf_f = mesh.entity_get_parent(AmanziMesh::CELL, c);
@@ -371,38 +372,49 @@ SEBEvaluator::EvaluateField_(const Teuchos::Ptr<State>& S,
       snow.emissivity = surf.emissivity;
       snow.roughness = roughness_snow_covered_ground_;
 
-      const SEBPhysics::EnergyBalance eb = SEBPhysics::UpdateEnergyBalanceWithSnow(surf, met, params, snow);
-      const SEBPhysics::MassBalance mb = SEBPhysics::UpdateMassBalanceWithSnow(surf, params, eb);
-      SEBPhysics::FluxBalance flux = SEBPhysics::UpdateFluxesWithSnow(surf, met, params, snow, eb, mb);
+      snow_patches_.push_back(c, surf, met, snow);
+    }
+  }
 
-      // fQe, Me positive is condensation, water flux positive to surface.  No need for subsurf as there is snow present.
-      mass_source[0][c] += area_fracs[1][c] * flux.M_surf;
-      energy_source[0][c] += area_fracs[1][c] * flux.E_surf * 1.e-6; // convert to MW/m^2 from W/m^2
-      snow_source[0][c] += area_fracs[1][c] * flux.M_snow;
+  // snow temperatures are solved for all snow-covered patches at once
+  SEBPhysics::UpdateEnergyBalanceWithSnow(params, snow_patches_);
+  for (int i=0; i!=snow_patches_.size(); ++i) {
+    int c = snow_patches_.id[i];
+    const SEBPhysics::GroundProperties& surf = snow_patches_.surf[i];
+    const SEBPhysics::MetData& met = snow_patches_.met[i];
+    const SEBPhysics::SnowProperties& snow = snow_patches_.snow[i];
+    const SEBPhysics::EnergyBalance& eb = snow_patches_.eb[i];
 
-      new_snow[0][c] += std::max(met.Ps + mb.Me, 0.) * area_fracs[1][c];
+    const SEBPhysics::MassBalance mb = SEBPhysics::UpdateMassBalanceWithSnow(surf, params, eb);
+    SEBPhysics::FluxBalance flux = SEBPhysics::UpdateFluxesWithSnow(surf, met, params, snow, eb, mb);
 
+    // fQe, Me positive is condensation, water flux positive to surface.  No need for subsurf as there is snow present.
+    mass_source[0][c] += area_fracs[1][c] * flux.M_surf;
+    energy_source[0][c] += area_fracs[1][c] * flux.E_surf * 1.e-6; // convert to MW/m^2 from W/m^2
+    snow_source[0][c] += area_fracs[1][c] * flux.M_snow;
 
-      if (vo_->os_OK(Teuchos::VERB_EXTREME))
-        *vo_->os() << "CELL " << c << " SNOW"
-                    << ": Ms = " << flux.M_surf << ", Es = " << flux.E_surf * 1.e-6
-                    << ", Mss = " << 0. << ", Ess = " << 0.
-                    << ", Sn = " << flux.M_snow << std::endl;
+    new_snow[0][c] += std::max(met.Ps + mb.Me, 0.) * area_fracs[1][c];
 
-      
-      // diagnostics
-      if (diagnostics_) {
-        (*evap_rate)[0][c] -= area_fracs[1][c] * mb.Me;
-        (*qE_sh)[0][c] += area_fracs[1][c] * eb.fQh;
-        (*qE_lh)[0][c] += area_fracs[1][c] * eb.fQe;
-        (*qE_lw_out)[0][c] += area_fracs[1][c] * eb.fQlwOut;
-        (*qE_cond)[0][c] += area_fracs[1][c] * eb.fQc;
-
-        (*qE_sm)[0][c] = area_fracs[1][c] * eb.fQm;
-        (*melt_rate)[0][c] = area_fracs[1][c] * mb.Mm;
-        (*snow_temp)[0][c] = snow.temp;
-        (*albedo)[0][c] += area_fracs[1][c] * surf.albedo;
-      }          
+
+    if (vo_->os_OK(Teuchos::VERB_EXTREME))
+      *vo_->os() << "CELL " << c << " SNOW"
+                  << ": Ms = " << flux.M_surf << ", Es = " << flux.E_surf * 1.e-6
+                  << ", Mss = " << 0. << ", Ess = " << 0.
+                  << ", Sn = " << flux.M_snow << std::endl;
+
+    
+    // diagnostics
+    if (diagnostics_) {
+      (*evap_rate)[0][c] -= area_fracs[1][c] * mb.Me;
+      (*qE_sh)[0][c] += area_fracs[1][c] * eb.fQh;
+      (*qE_lh)[0][c] += area_fracs[1][c] * eb.fQe;
+      (*qE_lw_out)[0][c] += area_fracs[1][c] * eb.fQlwOut;
+      (*qE_cond)[0][c] += area_fracs[1][c] * eb.fQc;
+
+      (*qE_sm)[0][c] = area_fracs[1][c] * eb.fQm;
+      (*melt_rate)[0][c] = area_fracs[1][c] * mb.Mm;
+      (*snow_temp)[0][c] = snow.temp;
+      (*albedo)[0][c] += area_fracs[1][c] * surf.albedo;
     }
   }
 
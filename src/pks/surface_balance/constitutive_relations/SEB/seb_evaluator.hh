@@ -92,6 +92,7 @@ the ground from the atmosphere.
 #include "Factory.hh"
 #include "Debugger.hh"
 #include "secondary_variables_field_evaluator.hh"
+#include "seb_physics_defs.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -159,6 +160,7 @@ class SEBEvaluator : public SecondaryVariablesFieldEvaluator {
 
   
   bool diagnostics_, ss_topcell_based_evap_;
+  SEBPhysics::SnowPatches snow_patches_; // work space for the batched snow solve
   Teuchos::RCP<Debugger> db_;
   Teuchos::RCP<Debugger> db_ss_;
   Teuchos::ParameterList plist_;
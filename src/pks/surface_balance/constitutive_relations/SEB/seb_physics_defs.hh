@@ -12,6 +12,7 @@
 #define SURFACEBALANCE_SEB_PHYSICS_DEFS_HH_
 
 #include <limits>
+#include <vector>
 #include "Teuchos_ParameterList.hpp"
 #if 0
 #define MY_LOCAL_NAN std::numeric_limits<double>::signaling_NaN()
@@ -217,6 +218,35 @@ struct FluxBalance {
 };
 
 
+// Snow-covered patches packed for a batched energy balance solve.  id is
+// whatever the caller needs to scatter results back, e.g. the cell.
+struct SnowPatches {
+  std::vector<int> id;
+  std::vector<GroundProperties> surf;
+  std::vector<MetData> met;
+  std::vector<SnowProperties> snow;
+  std::vector<EnergyBalance> eb;
+
+  int size() const { return id.size(); }
+
+  void clear() {
+    id.clear();
+    surf.clear();
+    met.clear();
+    snow.clear();
+    eb.clear();
+  }
+
+  void push_back(int id_, const GroundProperties& surf_, const MetData& met_,
+                 const SnowProperties& snow_) {
+    id.push_back(id_);
+    surf.push_back(surf_);
+    met.push_back(met_);
+    snow.push_back(snow_);
+  }
+};
+
+
 // Used to calculate surface properties, prior to calling SEB.
 struct SurfaceParams {
   double a_tundra, a_water, a_ice;      // albedos
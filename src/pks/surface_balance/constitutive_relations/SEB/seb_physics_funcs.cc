@@ -5,9 +5,11 @@
 #include <iostream>
 #include <cmath>
 #include <algorithm>
+#include <vector>
 #include "boost/math/tools/roots.hpp"
 
 #include "dbc.hh"
+#include "errors.hh"
 
 #include "seb_physics_funcs.hh"
 
@@ -169,16 +171,21 @@ double LatentHeat(double resistance_coef,
       * (vapor_pressure_air - vapor_pressure_skin) / Apa;
 }
 
-double ConductedHeatIfSnow(double ground_temp,
-                           const SnowProperties& snow, const ModelParams& params)
+static double SnowThermalConductivity_(const SnowProperties& snow, const ModelParams& params)
 {
-  // Calculate heat conducted to ground, if snow
   double density = snow.density;
   if (density > 150) {
     // adjust for frost hoar
     density = 1. / ((0.90/density) + (0.10/150));
   }
-  double Ks = params.thermalK_freshsnow * std::pow(density/params.density_freshsnow, params.thermalK_snow_exp);
+  return params.thermalK_freshsnow * std::pow(density/params.density_freshsnow, params.thermalK_snow_exp);
+}
+
+double ConductedHeatIfSnow(double ground_temp,
+                           const SnowProperties& snow, const ModelParams& params)
+{
+  // Calculate heat conducted to ground, if snow
+  double Ks = SnowThermalConductivity_(snow, params);
   return Ks * (snow.temp - ground_temp) / snow.height;
 }
 
@@ -212,17 +219,14 @@ void UpdateEnergyBalanceWithSnow_Inner(const GroundProperties& surf,
   eb.fQm = eb.fQswIn + eb.fQlwIn - eb.fQlwOut + eb.fQh - eb.fQc + eb.fQe;
 }
 
-EnergyBalance UpdateEnergyBalanceWithSnow(const GroundProperties& surf,
+// Given the unconstrained snow temperature, limit it to 0 C and put the
+// remaining energy into melt.
+static void FinishEnergyBalanceWithSnow_(const GroundProperties& surf,
         const MetData& met,
         const ModelParams& params,
-        SnowProperties& snow)
+        SnowProperties& snow,
+        EnergyBalance& eb)
 {
-  EnergyBalance eb;
-  
-  // snow on the ground, solve for snow temperature
-  std::tie(eb.fQswIn, eb.fQlwIn) = IncomingRadiation(met, snow.albedo);
-  snow.temp = DetermineSnowTemperature(surf, met, params, snow, eb);
-
   if (snow.temp > 273.15) {
     // limit snow temp to 0, then melt with the remaining energy
     snow.temp = 273.15;
@@ -234,10 +238,181 @@ EnergyBalance UpdateEnergyBalanceWithSnow(const GroundProperties& surf,
     eb.error = eb.fQm;
     eb.fQm = 0.;
   }
+}
+
+EnergyBalance UpdateEnergyBalanceWithSnow(const GroundProperties& surf,
+        const MetData& met,
+        const ModelParams& params,
+        SnowProperties& snow)
+{
+  EnergyBalance eb;
+  
+  // snow on the ground, solve for snow temperature
+  std::tie(eb.fQswIn, eb.fQlwIn) = IncomingRadiation(met, snow.albedo);
+  snow.temp = DetermineSnowTemperature(surf, met, params, snow, eb);
+  FinishEnergyBalanceWithSnow_(surf, met, params, snow, eb);
   return eb;
 }
 
 
+// Coefficients of the snow energy balance as a function of snow temperature,
+//
+//   fQm(T) = Qin - eps_sig T^4 - Ks_h (T - T_ground)
+//          + Dhe S(T) [ rhoCp (T_air - T) + cL (vp_air - vp_sat(T)) ],
+//
+// where S(T) is the stability function of Ri = Ri_coef (T_air - T).  This is
+// UpdateEnergyBalanceWithSnow_Inner() with everything that does not depend
+// on T hoisted out, stored one array per coefficient.
+struct SnowBalanceCoefs_ {
+  explicit SnowBalanceCoefs_(int n) :
+      Qin(n), eps_sig(n), Ks_h(n), T_ground(n), Dhe(n), Ri_coef(n), T_air(n), vp_air(n) {}
+
+  std::vector<double> Qin, eps_sig, Ks_h, T_ground, Dhe, Ri_coef, T_air, vp_air;
+};
+
+
+// Residual fQm and its derivative with respect to T, for one patch.
+static inline void
+SnowBalanceResidual_(const SnowBalanceCoefs_& c, int i, double rhoCp, double cL,
+                     double T, double& f, double& df)
+{
+  double Ri = c.Ri_coef[i] * (c.T_air[i] - T);
+  double denom = 1. / (1 + 10*Ri);
+  double S = Ri >= 0. ? denom : 1 - 10*Ri;
+  double dS = Ri >= 0. ? 10 * c.Ri_coef[i] * denom * denom : 10 * c.Ri_coef[i];
+
+  double tempC = T - 273.15;
+  double d = 1. / (tempC + 243.5);
+  double vp_sat = 0.6112 * std::exp(17.67 * tempC * d);
+  double dvp_sat = vp_sat * 17.67 * 243.5 * d * d;
+
+  double turb = rhoCp * (c.T_air[i] - T) + cL * (c.vp_air[i] - vp_sat);
+  double dturb = -rhoCp - cL * dvp_sat;
+
+  double T3 = T*T*T;
+  f = c.Qin[i] - c.eps_sig[i] * T3 * T - c.Ks_h[i] * (T - c.T_ground[i])
+      + c.Dhe[i] * S * turb;
+  df = -4 * c.eps_sig[i] * T3 - c.Ks_h[i] + c.Dhe[i] * (dS * turb + S * dturb);
+}
+
+
+void UpdateEnergyBalanceWithSnow(const ModelParams& params,
+        SnowPatches& patches)
+{
+  int n = patches.size();
+  patches.eb.resize(n);
+  if (n == 0) return;
+
+  // gather
+  SnowBalanceCoefs_ c(n);
+  std::vector<double> T(n);
+  for (int i=0; i!=n; ++i) {
+    const GroundProperties& surf = patches.surf[i];
+    const MetData& met = patches.met[i];
+    const SnowProperties& snow = patches.snow[i];
+    EnergyBalance& eb = patches.eb[i];
+
+    std::tie(eb.fQswIn, eb.fQlwIn) = IncomingRadiation(met, snow.albedo);
+    c.Qin[i] = eb.fQswIn + eb.fQlwIn;
+    c.eps_sig[i] = snow.emissivity * params.stephB;
+    c.Ks_h[i] = SnowThermalConductivity_(snow, params) / snow.height;
+    c.T_ground[i] = surf.temp;
+    c.Dhe[i] = WindFactor(met.Us, met.Z_Us,
+                          CalcRoughnessFactor(snow.height, surf.roughness, snow.roughness), params.VKc);
+    c.Ri_coef[i] = params.gravity * met.Z_Us / (met.air_temp * std::pow(met.Us,2));
+    c.T_air[i] = met.air_temp;
+    c.vp_air[i] = VaporPressureAir(met.air_temp, met.relative_humidity);
+    T[i] = surf.temp;
+  }
+  double rhoCp = params.density_air * params.Cp_air;
+  double cL = params.density_air * params.Ls * 0.622 / params.Apa;
+
+  // Bracket the root, stepping away from the ground temperature as
+  // DetermineSnowTemperature() does, but for all patches in lockstep and
+  // doubling the step each time so that the slowest patch does not hold up
+  // the others for long.  The bracket is kept with f(left) >= 0 >= f(right).
+  const int max_it = 100;
+  std::vector<double> left(n), right(n), f(n), df(n), step(n);
+  std::vector<int> active(n, 1);
+  for (int i=0; i<n; ++i) {
+    SnowBalanceResidual_(c, i, rhoCp, cL, T[i], f[i], df[i]);
+    step[i] = f[i] < 0. ? -1. : 1.;
+    left[i] = T[i];
+    right[i] = T[i];
+  }
+
+  int n_active = n;
+  for (int it=0; it!=max_it && n_active > 0; ++it) {
+    n_active = 0;
+    for (int i=0; i<n; ++i) {
+      bool down = step[i] < 0.;
+      double x = (down ? left[i] : right[i]) + step[i];
+      double fx, dfx;
+      SnowBalanceResidual_(c, i, rhoCp, cL, x, fx, dfx);
+      bool past = down ? !(fx < 0.) : !(fx > 0.);
+
+      // the end nearest the ground temperature moves up only until the root
+      // is passed, the far end always moves to x
+      double new_left = down ? x : (past ? left[i] : right[i]);
+      double new_right = down ? (past ? right[i] : left[i]) : x;
+      left[i] = active[i] ? new_left : left[i];
+      right[i] = active[i] ? new_right : right[i];
+
+      // Newton starts from the last point evaluated
+      T[i] = active[i] ? x : T[i];
+      f[i] = active[i] ? fx : f[i];
+      df[i] = active[i] ? dfx : df[i];
+      step[i] = active[i] ? 2 * step[i] : step[i];
+      active[i] = active[i] && !past;
+      n_active += active[i];
+    }
+  }
+
+  if (n_active > 0) {
+    Errors::Message msg("Surface Energy Balance failed to bracket the snow temperature");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  // Safeguarded Newton: steps that leave the bracket fall back to
+  // bisection.  Patches drop out of the iteration
+  // once the update is within tolerance.
+  const double tol = ENERGY_BALANCE_TOL;
+  std::fill(active.begin(), active.end(), 1);
+  n_active = n;
+  for (int it=0; it!=max_it && n_active > 0; ++it) {
+    n_active = 0;
+    for (int i=0; i<n; ++i) {
+      double x = T[i] - f[i] / df[i];
+      x = (x >= left[i] && x <= right[i]) ? x : 0.5 * (left[i] + right[i]);
+
+      double fx, dfx;
+      SnowBalanceResidual_(c, i, rhoCp, cL, x, fx, dfx);
+      bool converged = std::abs(x - T[i]) <= tol || right[i] - left[i] <= tol || fx == 0.;
+
+      left[i] = active[i] && fx > 0. ? x : left[i];
+      right[i] = active[i] && fx < 0. ? x : right[i];
+      T[i] = active[i] ? x : T[i];
+      f[i] = active[i] ? fx : f[i];
+      df[i] = active[i] ? dfx : df[i];
+      active[i] = active[i] && !converged;
+      n_active += active[i];
+    }
+  }
+
+  if (n_active > 0) {
+    Errors::Message msg("Nonconverged Surface Energy Balance");
+    Exceptions::amanzi_throw(msg);
+  }
+
+  // scatter
+  for (int i=0; i!=n; ++i) {
+    patches.snow[i].temp = T[i];
+    FinishEnergyBalanceWithSnow_(patches.surf[i], patches.met[i], params,
+            patches.snow[i], patches.eb[i]);
+  }
+}
+
+
 EnergyBalance UpdateEnergyBalanceWithoutSnow(const GroundProperties& surf,
         const MetData& met,
         const ModelParams& params)
@@ -292,7 +467,7 @@ double DetermineSnowTemperature(const GroundProperties& surf,
         const ModelParams& params, 
         SnowProperties& snow,
         EnergyBalance& eb,
-        std::string method)
+        const std::string& method)
 {
   SnowTemperatureFunctor_ func(&surf, &snow, &met, &params, &eb);
   Tol_ tol(ENERGY_BALANCE_TOL);
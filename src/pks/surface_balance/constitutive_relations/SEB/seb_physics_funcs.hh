@@ -137,7 +137,7 @@ double DetermineSnowTemperature(const GroundProperties& surf,
         const ModelParams& params,
         SnowProperties& snow,
         EnergyBalance& eb,
-        std::string method="toms");
+        const std::string& method="toms");
 
 
 // 
@@ -150,6 +150,15 @@ EnergyBalance UpdateEnergyBalanceWithSnow(const GroundProperties& surf,
         const ModelParams& params,
         SnowProperties& snow);
 
+// 
+// Batched version of the above, for all patches at once.  Snow temperatures
+// are solved together by a safeguarded Newton iteration, stepping all patches
+// in lockstep; on return patches.snow[i].temp and patches.eb[i] are set as by
+// the scalar version, to within the root-finding tolerance.
+// ------------------------------------------------------------------------------------------
+void UpdateEnergyBalanceWithSnow(const ModelParams& params,
+        SnowPatches& patches);
+
 // 
 // Update the energy balance, solving for the amount of heat conducted to the ground.
 //
@@ -99,6 +99,7 @@ depressions due to gravity- and wind-driven redistributions, respectively.
 #include "Factory.hh"
 #include "Debugger.hh"
 #include "secondary_variables_field_evaluator.hh"
+#include "seb_physics_defs.hh"
 
 namespace Amanzi {
 namespace SurfaceBalance {
@@ -166,6 +167,7 @@ class SubgridEvaluator : public SecondaryVariablesFieldEvaluator {
                                      // table drops below the surface.
   bool ss_topcell_based_evap_;
   bool diagnostics_;
+  SEBPhysics::SnowPatches snow_patches_; // work space for the batched snow solve
   Teuchos::RCP<Debugger> db_;
   Teuchos::RCP<Debugger> db_ss_;
   Teuchos::ParameterList plist_;
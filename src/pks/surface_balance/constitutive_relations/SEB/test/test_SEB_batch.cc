@@ -0,0 +1,110 @@
+#include "UnitTest++.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "seb_physics_defs.hh"
+#include "seb_physics_funcs.hh"
+
+using namespace Amanzi::SurfaceBalance::SEBPhysics;
+
+// A spread of snow-covered patches: cold to melting, dark to sunny, calm to
+// windy, thin to deep snow.
+static SnowPatches
+MakePatches(int n)
+{
+  SnowPatches patches;
+  for (int i=0; i!=n; ++i) {
+    double s = (i + 0.5) / n;
+
+    GroundProperties surf;
+    surf.temp = 255. + 20. * std::fmod(7*s, 1.);
+    surf.pressure = 101325.;
+    surf.roughness = 0.04;
+    surf.density_w = 1000.;
+    surf.dz = 0.1;
+    surf.albedo = 0.8;
+    surf.emissivity = 0.98;
+    surf.saturation_gas = 0.;
+    surf.porosity = 1.;
+    surf.unfrozen_fraction = 0.;
+
+    MetData met;
+    met.Z_Us = 2.;
+    met.Us = 1. + 7. * std::fmod(3*s, 1.);
+    met.QswIn = 600. * std::fmod(5*s, 1.);
+    met.QlwIn = 200. + 100. * std::fmod(11*s, 1.);
+    met.air_temp = 245. + 35. * s;
+    met.relative_humidity = 0.3 + 0.7 * std::fmod(13*s, 1.);
+    met.Ps = 0.;
+    met.Pr = 0.;
+
+    SnowProperties snow;
+    snow.height = 0.02 + std::fmod(17*s, 1.);
+    snow.density = 100. + 300. * std::fmod(19*s, 1.);
+    snow.albedo = surf.albedo;
+    snow.emissivity = surf.emissivity;
+    snow.roughness = 0.004;
+
+    patches.push_back(i, surf, met, snow);
+  }
+  return patches;
+}
+
+
+SUITE(SEB_BATCH) {
+
+  // The batched solve gives the scalar snow temperature and energy balance.
+  TEST(BATCH_MATCHES_SCALAR) {
+    ModelParams params;
+    SnowPatches patches = MakePatches(1000);
+    SnowPatches scalar = patches;
+
+    UpdateEnergyBalanceWithSnow(params, patches);
+    CHECK_EQUAL(1000, (int) patches.eb.size());
+
+    for (int i=0; i!=scalar.size(); ++i) {
+      EnergyBalance eb = UpdateEnergyBalanceWithSnow(scalar.surf[i], scalar.met[i],
+              params, scalar.snow[i]);
+      CHECK_CLOSE(scalar.snow[i].temp, patches.snow[i].temp, 1.e-6);
+      CHECK_CLOSE(eb.fQm, patches.eb[i].fQm, 1.e-4);
+      CHECK_CLOSE(eb.fQc, patches.eb[i].fQc, 1.e-4);
+      CHECK_CLOSE(eb.fQh, patches.eb[i].fQh, 1.e-4);
+      CHECK_CLOSE(eb.fQe, patches.eb[i].fQe, 1.e-4);
+      CHECK_CLOSE(eb.fQlwOut, patches.eb[i].fQlwOut, 1.e-4);
+      CHECK(std::abs(patches.eb[i].error) < 1.e-3);
+    }
+  }
+
+  TEST(BATCH_EMPTY) {
+    ModelParams params;
+    SnowPatches patches;
+    UpdateEnergyBalanceWithSnow(params, patches);
+    CHECK_EQUAL(0, (int) patches.eb.size());
+  }
+
+  // Timing of the batched against the scalar path.
+  TEST(BATCH_BENCHMARK) {
+    ModelParams params;
+    const int n = 100000;
+    SnowPatches patches = MakePatches(n);
+    SnowPatches scalar = patches;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i=0; i!=n; ++i) {
+      UpdateEnergyBalanceWithSnow(scalar.surf[i], scalar.met[i], params, scalar.snow[i]);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    UpdateEnergyBalanceWithSnow(params, patches);
+    auto t2 = std::chrono::steady_clock::now();
+
+    double t_scalar = std::chrono::duration<double>(t1 - t0).count();
+    double t_batch = std::chrono::duration<double>(t2 - t1).count();
+    std::cout << "SEB snow temperature, " << n << " patches: scalar " << t_scalar
+              << " s, batched " << t_batch << " s" << std::endl;
+    CHECK(t_batch > 0.);
+  }
+
+}
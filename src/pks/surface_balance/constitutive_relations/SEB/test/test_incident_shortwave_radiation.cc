@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <cmath>
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+#include "incident_shortwave_radiation_model.hh"
+
+using namespace Amanzi::SurfaceBalance::Relations;
+
+// Compare the analytic derivatives, both the per-point and the batched
+// versions, with centered differences over a spread of slopes, aspects and
+// times.  Points are chosen so that the aspect modifier stays away from its
+// limits, where it is not differentiable.
+static void
+CheckDerivatives(bool daily_avg, double lat)
+{
+  Teuchos::ParameterList plist;
+  plist.set("daily averaged", daily_avg);
+  plist.set("latitude [degrees]", lat);
+  plist.set("day of year at time 0 [Julian days]", 100);
+  IncidentShortwaveRadiationModel model(plist);
+
+  double qSWin = 250.;
+  double eps = 1.e-6;
+  double tol = 1.e-6;
+  for (double slope : { 0.05, 0.2, 0.5 }) {
+    for (double aspect : { 0.3, 1.7, 3.1, 4.6, 5.9 }) {
+      // noon, and a couple of hours either side, on days 100 through 102
+      for (double time : { 0., 6000., 86400. - 6000., 86400. * 2.4 }) {
+        double dslope = model.DIncidentShortwaveRadiationDSlope(slope, aspect, qSWin, time);
+        double fd_slope = (model.IncidentShortwaveRadiation(slope + eps, aspect, qSWin, time)
+                           - model.IncidentShortwaveRadiation(slope - eps, aspect, qSWin, time)) / (2*eps);
+        CHECK_CLOSE(fd_slope, dslope, tol * std::max(1., std::abs(fd_slope)));
+
+        double daspect = model.DIncidentShortwaveRadiationDAspect(slope, aspect, qSWin, time);
+        double fd_aspect = (model.IncidentShortwaveRadiation(slope, aspect + eps, qSWin, time)
+                            - model.IncidentShortwaveRadiation(slope, aspect - eps, qSWin, time)) / (2*eps);
+        CHECK_CLOSE(fd_aspect, daspect, tol * std::max(1., std::abs(fd_aspect)));
+
+        double dq = model.DIncidentShortwaveRadiationDIncomingShortwaveRadiation(slope, aspect, qSWin, time);
+        double fd_q = (model.IncidentShortwaveRadiation(slope, aspect, qSWin + eps, time)
+                       - model.IncidentShortwaveRadiation(slope, aspect, qSWin - eps, time)) / (2*eps);
+        CHECK_CLOSE(fd_q, dq, tol);
+
+        // batched versions agree with the per-point ones
+        SolarGeometry geom = model.ComputeSolarGeometry(time);
+        SlopeAspectTrig trig = IncidentShortwaveRadiationModel::ComputeSlopeAspectTrig(slope, aspect);
+        CHECK_CLOSE(model.IncidentShortwaveRadiation(slope, aspect, qSWin, time),
+                    model.IncidentShortwaveRadiation(geom, trig, qSWin), 1.e-12);
+        CHECK_CLOSE(dslope, model.DIncidentShortwaveRadiationDSlope(geom, trig, qSWin), 1.e-12);
+        CHECK_CLOSE(daspect, model.DIncidentShortwaveRadiationDAspect(geom, trig, qSWin), 1.e-12);
+        CHECK_CLOSE(dq, model.DIncidentShortwaveRadiationDIncomingShortwaveRadiation(geom, trig, qSWin), 1.e-12);
+      }
+    }
+  }
+}
+
+
+TEST(IncidentShortwaveRadiationDerivativesDailyAveraged) {
+  CheckDerivatives(true, 45.);
+  CheckDerivatives(true, -30.);
+}
+
+TEST(IncidentShortwaveRadiationDerivativesHourly) {
+  CheckDerivatives(false, 45.);
+  CheckDerivatives(false, -30.);
+}
@@ -59,12 +59,12 @@ Teuchos::RCP<const CompositeVector> ai = S->GetFieldData(ai_key_);
 
   for (CompositeVector::name_iterator comp=result->begin();
        comp!=result->end(); ++comp) {
-    const Epetra_MultiVector& ai_v = *ai->ViewComponent(*comp, false);
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+    const double* __restrict ai_v = (*ai->ViewComponent(*comp, false))[0];
+    double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
     int ncomp = result->size(*comp, false);
     for (int i=0; i!=ncomp; ++i) {
-      result_v[0][i] = model_->InterceptionFraction(ai_v[0][i]);
+      result_v[i] = model_->InterceptionFraction(ai_v[i]);
     }
   }
 }
@@ -79,12 +79,12 @@ Teuchos::RCP<const CompositeVector> ai = S->GetFieldData(ai_key_);
   if (wrt_key == ai_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& ai_v = *ai->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict ai_v = (*ai->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DInterceptionFractionDAreaIndex(ai_v[0][i]);
+        result_v[i] = model_->DInterceptionFractionDAreaIndex(ai_v[i]);
       }
     }
 
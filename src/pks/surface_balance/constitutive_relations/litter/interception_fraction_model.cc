@@ -30,19 +30,6 @@ InterceptionFractionModel::InitializeFromPlist_(Teuchos::ParameterList& plist)
 }
 
 
-// main method
-double
-InterceptionFractionModel::InterceptionFraction(double ai) const
-{
-  return alpha_*(1 - exp(-0.5*ai));
-}
-
-double
-InterceptionFractionModel::DInterceptionFractionDAreaIndex(double ai) const
-{
-  return 0.5*alpha_*exp(-0.5*ai);
-}
-
 } //namespace
 } //namespace
 } //namespace
@@ -10,6 +10,9 @@
 #ifndef AMANZI_SURFACEBALANCE_INTERCEPTION_FRACTION_MODEL_HH_
 #define AMANZI_SURFACEBALANCE_INTERCEPTION_FRACTION_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace SurfaceBalance {
 namespace Relations {
@@ -33,6 +36,22 @@ class InterceptionFractionModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+InterceptionFractionModel::InterceptionFraction(double ai) const
+{
+  return alpha_*(1 - exp(-0.5*ai));
+}
+
+inline double
+InterceptionFractionModel::DInterceptionFractionDAreaIndex(double ai) const
+{
+  return 0.5*alpha_*exp(-0.5*ai);
+}
+
 } //namespace
 } //namespace
 } //namespace
@@ -7,7 +7,7 @@
     namespaceCaps = SURFACEBALANCE
     namespace = SurfaceBalance
     evalNameCaps = MACROPORE_SURFACE_FLUX
-    myMethodArgs = pM_v[0][i], ps_v[0][i], krs_v[0][i], krM_v[0][i], K_v[0][i]
+    myMethodArgs = pM_v[i], ps_v[i], krs_v[i], krM_v[i], K_v[i]
     myKeyMethod = MacroporeSurfaceFlux
     myKeyFirst = macropore
     evalNameString = macropore-surface flux
@@ -110,16 +110,16 @@ Teuchos::RCP<const CompositeVector> K = S->GetFieldData(K_key_);
 
   for (CompositeVector::name_iterator comp=result->begin();
        comp!=result->end(); ++comp) {
-    const Epetra_MultiVector& pM_v = *pM->ViewComponent(*comp, false);
-    const Epetra_MultiVector& ps_v = *ps->ViewComponent(*comp, false);
-    const Epetra_MultiVector& krs_v = *krs->ViewComponent(*comp, false);
-    const Epetra_MultiVector& krM_v = *krM->ViewComponent(*comp, false);
-    const Epetra_MultiVector& K_v = *K->ViewComponent(*comp, false);
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+    const double* __restrict pM_v = (*pM->ViewComponent(*comp, false))[0];
+    const double* __restrict ps_v = (*ps->ViewComponent(*comp, false))[0];
+    const double* __restrict krs_v = (*krs->ViewComponent(*comp, false))[0];
+    const double* __restrict krM_v = (*krM->ViewComponent(*comp, false))[0];
+    const double* __restrict K_v = (*K->ViewComponent(*comp, false))[0];
+    double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
     int ncomp = result->size(*comp, false);
     for (int i=0; i!=ncomp; ++i) {
-      result_v[0][i] = model_->MacroporeSurfaceFlux(pM_v[0][i], ps_v[0][i], krs_v[0][i], krM_v[0][i], K_v[0][i]);        
+      result_v[i] = model_->MacroporeSurfaceFlux(pM_v[i], ps_v[i], krs_v[i], krM_v[i], K_v[i]);
     }
   }
 }
@@ -138,80 +138,80 @@ Teuchos::RCP<const CompositeVector> K = S->GetFieldData(K_key_);
   if (wrt_key == pM_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& pM_v = *pM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ps_v = *ps->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krs_v = *krs->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krM_v = *krM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& K_v = *K->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict pM_v = (*pM->ViewComponent(*comp, false))[0];
+      const double* __restrict ps_v = (*ps->ViewComponent(*comp, false))[0];
+      const double* __restrict krs_v = (*krs->ViewComponent(*comp, false))[0];
+      const double* __restrict krM_v = (*krM->ViewComponent(*comp, false))[0];
+      const double* __restrict K_v = (*K->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DMacroporeSurfaceFluxDMacroporePressure(pM_v[0][i], ps_v[0][i], krs_v[0][i], krM_v[0][i], K_v[0][i]);
+        result_v[i] = model_->DMacroporeSurfaceFluxDMacroporePressure(pM_v[i], ps_v[i], krs_v[i], krM_v[i], K_v[i]);
       }
     }
 
   } else if (wrt_key == ps_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& pM_v = *pM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ps_v = *ps->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krs_v = *krs->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krM_v = *krM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& K_v = *K->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict pM_v = (*pM->ViewComponent(*comp, false))[0];
+      const double* __restrict ps_v = (*ps->ViewComponent(*comp, false))[0];
+      const double* __restrict krs_v = (*krs->ViewComponent(*comp, false))[0];
+      const double* __restrict krM_v = (*krM->ViewComponent(*comp, false))[0];
+      const double* __restrict K_v = (*K->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DMacroporeSurfaceFluxDSurfacePressure(pM_v[0][i], ps_v[0][i], krs_v[0][i], krM_v[0][i], K_v[0][i]);
+        result_v[i] = model_->DMacroporeSurfaceFluxDSurfacePressure(pM_v[i], ps_v[i], krs_v[i], krM_v[i], K_v[i]);
       }
     }
 
   } else if (wrt_key == krs_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& pM_v = *pM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ps_v = *ps->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krs_v = *krs->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krM_v = *krM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& K_v = *K->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict pM_v = (*pM->ViewComponent(*comp, false))[0];
+      const double* __restrict ps_v = (*ps->ViewComponent(*comp, false))[0];
+      const double* __restrict krs_v = (*krs->ViewComponent(*comp, false))[0];
+      const double* __restrict krM_v = (*krM->ViewComponent(*comp, false))[0];
+      const double* __restrict K_v = (*K->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DMacroporeSurfaceFluxDSurfaceRelativePermeability(pM_v[0][i], ps_v[0][i], krs_v[0][i], krM_v[0][i], K_v[0][i]);
+        result_v[i] = model_->DMacroporeSurfaceFluxDSurfaceRelativePermeability(pM_v[i], ps_v[i], krs_v[i], krM_v[i], K_v[i]);
       }
     }
 
   } else if (wrt_key == krM_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& pM_v = *pM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ps_v = *ps->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krs_v = *krs->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krM_v = *krM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& K_v = *K->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict pM_v = (*pM->ViewComponent(*comp, false))[0];
+      const double* __restrict ps_v = (*ps->ViewComponent(*comp, false))[0];
+      const double* __restrict krs_v = (*krs->ViewComponent(*comp, false))[0];
+      const double* __restrict krM_v = (*krM->ViewComponent(*comp, false))[0];
+      const double* __restrict K_v = (*K->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DMacroporeSurfaceFluxDMacroporeRelativePermeability(pM_v[0][i], ps_v[0][i], krs_v[0][i], krM_v[0][i], K_v[0][i]);
+        result_v[i] = model_->DMacroporeSurfaceFluxDMacroporeRelativePermeability(pM_v[i], ps_v[i], krs_v[i], krM_v[i], K_v[i]);
       }
     }
 
   } else if (wrt_key == K_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& pM_v = *pM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& ps_v = *ps->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krs_v = *krs->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krM_v = *krM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& K_v = *K->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict pM_v = (*pM->ViewComponent(*comp, false))[0];
+      const double* __restrict ps_v = (*ps->ViewComponent(*comp, false))[0];
+      const double* __restrict krs_v = (*krs->ViewComponent(*comp, false))[0];
+      const double* __restrict krM_v = (*krM->ViewComponent(*comp, false))[0];
+      const double* __restrict K_v = (*K->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DMacroporeSurfaceFluxDMacroporeAbsolutePermeability(pM_v[0][i], ps_v[0][i], krs_v[0][i], krM_v[0][i], K_v[0][i]);
+        result_v[i] = model_->DMacroporeSurfaceFluxDMacroporeAbsolutePermeability(pM_v[i], ps_v[i], krs_v[i], krM_v[i], K_v[i]);
       }
     }
 
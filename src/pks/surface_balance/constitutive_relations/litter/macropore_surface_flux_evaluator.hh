@@ -7,7 +7,7 @@
     namespaceCaps = SURFACEBALANCE
     namespace = SurfaceBalance
     evalNameCaps = MACROPORE_SURFACE_FLUX
-    myMethodArgs = pM_v[0][i], ps_v[0][i], krs_v[0][i], krM_v[0][i], K_v[0][i]
+    myMethodArgs = pM_v[i], ps_v[i], krs_v[i], krM_v[i], K_v[i]
     myKeyMethod = MacroporeSurfaceFlux
     myKeyFirst = macropore
     evalNameString = macropore-surface flux
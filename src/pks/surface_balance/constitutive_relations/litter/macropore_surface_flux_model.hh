@@ -7,7 +7,7 @@
     namespaceCaps = SURFACEBALANCE
     namespace = SurfaceBalance
     evalNameCaps = MACROPORE_SURFACE_FLUX
-    myMethodArgs = pM_v[0][i], ps_v[0][i], krs_v[0][i], krM_v[0][i], K_v[0][i]
+    myMethodArgs = pM_v[i], ps_v[i], krs_v[i], krM_v[i], K_v[i]
     myKeyMethod = MacroporeSurfaceFlux
     myKeyFirst = macropore
     evalNameString = macropore-surface flux
@@ -21,6 +21,9 @@
 #ifndef AMANZI_SURFACEBALANCE_MACROPORE_SURFACE_FLUX_MODEL_HH_
 #define AMANZI_SURFACEBALANCE_MACROPORE_SURFACE_FLUX_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace SurfaceBalance {
 namespace Relations {
@@ -50,6 +53,52 @@ class MacroporeSurfaceFluxModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+MacroporeSurfaceFluxModel::MacroporeSurfaceFlux(double pM, double ps, double krs, double krM, double K) const
+{
+  double C = gamma_ / delta_ * K * ( (pM > ps) ? krM : 0.);
+  return C * (ps - pM);
+}
+
+inline double
+MacroporeSurfaceFluxModel::DMacroporeSurfaceFluxDMacroporePressure(double pM, double ps, double krs, double krM, double K) const
+{
+  double C = gamma_ / delta_ * K * ( (pM > ps) ? krM : 0.);
+  return -C;
+}
+
+inline double
+MacroporeSurfaceFluxModel::DMacroporeSurfaceFluxDSurfacePressure(double pM, double ps, double krs, double krM, double K) const
+{
+  double C = gamma_ / delta_ * K * ( (pM > ps) ? krM : 0.);
+  return C;
+}
+
+inline double
+MacroporeSurfaceFluxModel::DMacroporeSurfaceFluxDSurfaceRelativePermeability(double pM, double ps, double krs, double krM, double K) const
+{
+  return 0.;
+}
+
+inline double
+MacroporeSurfaceFluxModel::DMacroporeSurfaceFluxDMacroporeRelativePermeability(double pM, double ps, double krs, double krM, double K) const
+{
+  if (pM > ps)
+    return gamma_ / delta_ * K * (ps - pM);
+  return 0.;
+}
+
+inline double
+MacroporeSurfaceFluxModel::DMacroporeSurfaceFluxDMacroporeAbsolutePermeability(double pM, double ps, double krs, double krM, double K) const
+{
+  double C = gamma_ / delta_ * ( (pM > ps) ? krM : 0.);
+  return C * (ps - pM);
+}
+
 } //namespace
 } //namespace
 } //namespace
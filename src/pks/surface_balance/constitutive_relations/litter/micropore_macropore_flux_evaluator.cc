@@ -7,7 +7,7 @@
     namespaceCaps = SURFACEBALANCE
     namespace = SurfaceBalance
     evalNameCaps = MICROPORE_MACROPORE_FLUX
-    myMethodArgs = pm_v[0][i], pM_v[0][i], krM_v[0][i], krm_v[0][i], K_v[0][i]
+    myMethodArgs = pm_v[i], pM_v[i], krM_v[i], krm_v[i], K_v[i]
     myKeyMethod = MicroporeMacroporeFlux
     myKeyFirst = micropore
     evalNameString = micropore-macropore flux
@@ -110,16 +110,16 @@ Teuchos::RCP<const CompositeVector> K = S->GetFieldData(K_key_);
 
   for (CompositeVector::name_iterator comp=result->begin();
        comp!=result->end(); ++comp) {
-    const Epetra_MultiVector& pm_v = *pm->ViewComponent(*comp, false);
-    const Epetra_MultiVector& pM_v = *pM->ViewComponent(*comp, false);
-    const Epetra_MultiVector& krM_v = *krM->ViewComponent(*comp, false);
-    const Epetra_MultiVector& krm_v = *krm->ViewComponent(*comp, false);
-    const Epetra_MultiVector& K_v = *K->ViewComponent(*comp, false);
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+    const double* __restrict pm_v = (*pm->ViewComponent(*comp, false))[0];
+    const double* __restrict pM_v = (*pM->ViewComponent(*comp, false))[0];
+    const double* __restrict krM_v = (*krM->ViewComponent(*comp, false))[0];
+    const double* __restrict krm_v = (*krm->ViewComponent(*comp, false))[0];
+    const double* __restrict K_v = (*K->ViewComponent(*comp, false))[0];
+    double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
     int ncomp = result->size(*comp, false);
     for (int i=0; i!=ncomp; ++i) {
-      result_v[0][i] = model_->MicroporeMacroporeFlux(pm_v[0][i], pM_v[0][i], krM_v[0][i], krm_v[0][i], K_v[0][i]);
+      result_v[i] = model_->MicroporeMacroporeFlux(pm_v[i], pM_v[i], krM_v[i], krm_v[i], K_v[i]);
     }
   }
 }
@@ -138,80 +138,80 @@ Teuchos::RCP<const CompositeVector> K = S->GetFieldData(K_key_);
   if (wrt_key == pm_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& pm_v = *pm->ViewComponent(*comp, false);
-      const Epetra_MultiVector& pM_v = *pM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krM_v = *krM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krm_v = *krm->ViewComponent(*comp, false);
-      const Epetra_MultiVector& K_v = *K->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict pm_v = (*pm->ViewComponent(*comp, false))[0];
+      const double* __restrict pM_v = (*pM->ViewComponent(*comp, false))[0];
+      const double* __restrict krM_v = (*krM->ViewComponent(*comp, false))[0];
+      const double* __restrict krm_v = (*krm->ViewComponent(*comp, false))[0];
+      const double* __restrict K_v = (*K->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DMicroporeMacroporeFluxDMicroporePressure(pm_v[0][i], pM_v[0][i], krM_v[0][i], krm_v[0][i], K_v[0][i]);
+        result_v[i] = model_->DMicroporeMacroporeFluxDMicroporePressure(pm_v[i], pM_v[i], krM_v[i], krm_v[i], K_v[i]);
       }
     }
 
   } else if (wrt_key == pM_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& pm_v = *pm->ViewComponent(*comp, false);
-      const Epetra_MultiVector& pM_v = *pM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krM_v = *krM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krm_v = *krm->ViewComponent(*comp, false);
-      const Epetra_MultiVector& K_v = *K->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict pm_v = (*pm->ViewComponent(*comp, false))[0];
+      const double* __restrict pM_v = (*pM->ViewComponent(*comp, false))[0];
+      const double* __restrict krM_v = (*krM->ViewComponent(*comp, false))[0];
+      const double* __restrict krm_v = (*krm->ViewComponent(*comp, false))[0];
+      const double* __restrict K_v = (*K->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DMicroporeMacroporeFluxDPressure(pm_v[0][i], pM_v[0][i], krM_v[0][i], krm_v[0][i], K_v[0][i]);
+        result_v[i] = model_->DMicroporeMacroporeFluxDPressure(pm_v[i], pM_v[i], krM_v[i], krm_v[i], K_v[i]);
       }
     }
 
   } else if (wrt_key == krM_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& pm_v = *pm->ViewComponent(*comp, false);
-      const Epetra_MultiVector& pM_v = *pM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krM_v = *krM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krm_v = *krm->ViewComponent(*comp, false);
-      const Epetra_MultiVector& K_v = *K->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict pm_v = (*pm->ViewComponent(*comp, false))[0];
+      const double* __restrict pM_v = (*pM->ViewComponent(*comp, false))[0];
+      const double* __restrict krM_v = (*krM->ViewComponent(*comp, false))[0];
+      const double* __restrict krm_v = (*krm->ViewComponent(*comp, false))[0];
+      const double* __restrict K_v = (*K->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DMicroporeMacroporeFluxDRelativePermeability(pm_v[0][i], pM_v[0][i], krM_v[0][i], krm_v[0][i], K_v[0][i]);
+        result_v[i] = model_->DMicroporeMacroporeFluxDRelativePermeability(pm_v[i], pM_v[i], krM_v[i], krm_v[i], K_v[i]);
       }
     }
 
   } else if (wrt_key == krm_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& pm_v = *pm->ViewComponent(*comp, false);
-      const Epetra_MultiVector& pM_v = *pM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krM_v = *krM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krm_v = *krm->ViewComponent(*comp, false);
-      const Epetra_MultiVector& K_v = *K->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict pm_v = (*pm->ViewComponent(*comp, false))[0];
+      const double* __restrict pM_v = (*pM->ViewComponent(*comp, false))[0];
+      const double* __restrict krM_v = (*krM->ViewComponent(*comp, false))[0];
+      const double* __restrict krm_v = (*krm->ViewComponent(*comp, false))[0];
+      const double* __restrict K_v = (*K->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DMicroporeMacroporeFluxDMicroporeRelativePermeability(pm_v[0][i], pM_v[0][i], krM_v[0][i], krm_v[0][i], K_v[0][i]);
+        result_v[i] = model_->DMicroporeMacroporeFluxDMicroporeRelativePermeability(pm_v[i], pM_v[i], krM_v[i], krm_v[i], K_v[i]);
       }
     }
 
   } else if (wrt_key == K_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& pm_v = *pm->ViewComponent(*comp, false);
-      const Epetra_MultiVector& pM_v = *pM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krM_v = *krM->ViewComponent(*comp, false);
-      const Epetra_MultiVector& krm_v = *krm->ViewComponent(*comp, false);
-      const Epetra_MultiVector& K_v = *K->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict pm_v = (*pm->ViewComponent(*comp, false))[0];
+      const double* __restrict pM_v = (*pM->ViewComponent(*comp, false))[0];
+      const double* __restrict krM_v = (*krM->ViewComponent(*comp, false))[0];
+      const double* __restrict krm_v = (*krm->ViewComponent(*comp, false))[0];
+      const double* __restrict K_v = (*K->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DMicroporeMacroporeFluxDMicroporeAbsolutePermeability(pm_v[0][i], pM_v[0][i], krM_v[0][i], krm_v[0][i], K_v[0][i]);
+        result_v[i] = model_->DMicroporeMacroporeFluxDMicroporeAbsolutePermeability(pm_v[i], pM_v[i], krM_v[i], krm_v[i], K_v[i]);
       }
     }
 
@@ -7,7 +7,7 @@
     namespaceCaps = SURFACEBALANCE
     namespace = SurfaceBalance
     evalNameCaps = MICROPORE_MACROPORE_FLUX
-    myMethodArgs = pm_v[0][i], pM_v[0][i], krM_v[0][i], krm_v[0][i], K_v[0][i]
+    myMethodArgs = pm_v[i], pM_v[i], krM_v[i], krm_v[i], K_v[i]
     myKeyMethod = MicroporeMacroporeFlux
     myKeyFirst = micropore
     evalNameString = micropore-macropore flux
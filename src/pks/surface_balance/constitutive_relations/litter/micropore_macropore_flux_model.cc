@@ -7,7 +7,7 @@
     namespaceCaps = SURFACEBALANCE
     namespace = SurfaceBalance
     evalNameCaps = MICROPORE_MACROPORE_FLUX
-    myMethodArgs = pm_v[0][i], pM_v[0][i], krM_v[0][i], krm_v[0][i], K_v[0][i]
+    myMethodArgs = pm_v[i], pM_v[i], krM_v[i], krm_v[i], K_v[i]
     myKeyMethod = MicroporeMacroporeFlux
     myKeyFirst = micropore
     evalNameString = micropore-macropore flux
@@ -42,49 +42,6 @@ MicroporeMacroporeFluxModel::InitializeFromPlist_(Teuchos::ParameterList& plist)
 }
 
 
-// main method
-double
-MicroporeMacroporeFluxModel::MicroporeMacroporeFlux(double pm, double pM, double krM, double krm, double K) const
-{
-  double C = gamma_ / delta_ * K * (pm > pM ? krm : krM);
-  return C * (pM - pm);
-}
-
-double
-MicroporeMacroporeFluxModel::DMicroporeMacroporeFluxDMicroporePressure(double pm, double pM, double krM, double krm, double K) const
-{
-  double C = gamma_ / delta_ * K * (pm > pM ? krm : krM);
-  return -C;
-}
-
-double
-MicroporeMacroporeFluxModel::DMicroporeMacroporeFluxDPressure(double pm, double pM, double krM, double krm, double K) const
-{
-  double C = gamma_ / delta_ * K * (pm > pM ? krm : krM);
-  return C;
-}
-
-double
-MicroporeMacroporeFluxModel::DMicroporeMacroporeFluxDRelativePermeability(double pm, double pM, double krM, double krm, double K) const
-{
-  double C = gamma_ / delta_ * K * (pm > pM ? 0. : 1.);
-  return C * (pM - pm);
-}
-
-double
-MicroporeMacroporeFluxModel::DMicroporeMacroporeFluxDMicroporeRelativePermeability(double pm, double pM, double krM, double krm, double K) const
-{
-  double C = gamma_ / delta_ * K * (pm > pM ? 1. : 0.);
-  return C * (pM - pm);
-}
-
-double
-MicroporeMacroporeFluxModel::DMicroporeMacroporeFluxDMicroporeAbsolutePermeability(double pm, double pM, double krM, double krm, double K) const
-{
-  double C = gamma_ / delta_ * (pm > pM ? krm : krM);
-  return C * (pM - pm);
-}
-
 } //namespace
 } //namespace
 } //namespace
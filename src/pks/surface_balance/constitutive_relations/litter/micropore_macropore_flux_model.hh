@@ -7,7 +7,7 @@
     namespaceCaps = SURFACEBALANCE
     namespace = SurfaceBalance
     evalNameCaps = MICROPORE_MACROPORE_FLUX
-    myMethodArgs = pm_v[0][i], pM_v[0][i], krM_v[0][i], krm_v[0][i], K_v[0][i]
+    myMethodArgs = pm_v[i], pM_v[i], krM_v[i], krm_v[i], K_v[i]
     myKeyMethod = MicroporeMacroporeFlux
     myKeyFirst = micropore
     evalNameString = micropore-macropore flux
@@ -21,6 +21,9 @@
 #ifndef AMANZI_SURFACEBALANCE_MICROPORE_MACROPORE_FLUX_MODEL_HH_
 #define AMANZI_SURFACEBALANCE_MICROPORE_MACROPORE_FLUX_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace SurfaceBalance {
 namespace Relations {
@@ -49,6 +52,52 @@ class MicroporeMacroporeFluxModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+MicroporeMacroporeFluxModel::MicroporeMacroporeFlux(double pm, double pM, double krM, double krm, double K) const
+{
+  double C = gamma_ / delta_ * K * (pm > pM ? krm : krM);
+  return C * (pM - pm);
+}
+
+inline double
+MicroporeMacroporeFluxModel::DMicroporeMacroporeFluxDMicroporePressure(double pm, double pM, double krM, double krm, double K) const
+{
+  double C = gamma_ / delta_ * K * (pm > pM ? krm : krM);
+  return -C;
+}
+
+inline double
+MicroporeMacroporeFluxModel::DMicroporeMacroporeFluxDPressure(double pm, double pM, double krM, double krm, double K) const
+{
+  double C = gamma_ / delta_ * K * (pm > pM ? krm : krM);
+  return C;
+}
+
+inline double
+MicroporeMacroporeFluxModel::DMicroporeMacroporeFluxDRelativePermeability(double pm, double pM, double krM, double krm, double K) const
+{
+  double C = gamma_ / delta_ * K * (pm > pM ? 0. : 1.);
+  return C * (pM - pm);
+}
+
+inline double
+MicroporeMacroporeFluxModel::DMicroporeMacroporeFluxDMicroporeRelativePermeability(double pm, double pM, double krM, double krm, double K) const
+{
+  double C = gamma_ / delta_ * K * (pm > pM ? 1. : 0.);
+  return C * (pM - pm);
+}
+
+inline double
+MicroporeMacroporeFluxModel::DMicroporeMacroporeFluxDMicroporeAbsolutePermeability(double pm, double pM, double krM, double krm, double K) const
+{
+  double C = gamma_ / delta_ * (pm > pM ? krm : krM);
+  return C * (pM - pm);
+}
+
 } //namespace
 } //namespace
 } //namespace
@@ -0,0 +1,151 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! Cached index maps between surface cells and subsurface faces.
+
+/*
+  A surface mesh extracted from the top of a subsurface mesh has one cell per
+  subsurface boundary face.  Coupling a surface vector to a subsurface vector
+  means, for each surface cell, finding the parent face and, if the
+  subsurface vector stores "boundary_face" rather than "face" values,
+  translating that face's local ID to a boundary face local ID through GIDs.
+
+  These maps are purely topological, so they are computed once and shared by
+  all callers.  They are stored as extra data on the RCP of the mesh they
+  index from -- the face map on the subsurface mesh and the surface map on
+  the surface mesh, which has a single parent -- and so are destroyed along
+  with that mesh.  Coupling MPCs build them in Setup().  Gather and scatter
+  then stream over flat index arrays.
+*/
+
+#ifndef ATS_SURFACE_SUBSURFACE_INDEX_MAP_HH_
+#define ATS_SURFACE_SUBSURFACE_INDEX_MAP_HH_
+
+#include <string>
+#include <vector>
+
+#include "Teuchos_RCP.hpp"
+#include "Epetra_Map.h"
+#include "Epetra_MultiVector.h"
+
+#include "errors.hh"
+#include "Mesh.hh"
+#include "CompositeVector.hh"
+
+namespace Amanzi {
+
+// -----------------------------------------------------------------------------
+// Map from owned faces of a mesh to boundary face local IDs, -1 if the face
+// is not on the boundary.  Built on first use and stored on the mesh.
+// -----------------------------------------------------------------------------
+inline const std::vector<int>&
+GetFaceToBoundaryFaceMap(const Teuchos::RCP<const AmanziMesh::Mesh>& mesh)
+{
+  const std::string name("face to boundary face map");
+  auto bfs = Teuchos::get_optional_extra_data<std::vector<int> >(mesh, name);
+  if (bfs.is_null()) {
+    const Epetra_Map& vandelay_map = mesh->exterior_face_map(false);
+    const Epetra_Map& face_map = mesh->face_map(false);
+    int nfaces = face_map.NumMyElements();
+    std::vector<int> map(nfaces);
+    for (int f=0; f!=nfaces; ++f) map[f] = vandelay_map.LID(face_map.GID(f));
+
+    Teuchos::RCP<const AmanziMesh::Mesh> mesh_node(mesh);
+    Teuchos::set_extra_data(map, name, Teuchos::outArg(mesh_node), Teuchos::PRE_DESTROY);
+    bfs = Teuchos::get_optional_extra_data<std::vector<int> >(mesh, name);
+  }
+  return *bfs;
+}
+
+
+class SurfaceSubsurfaceIndexMap {
+
+ public:
+  SurfaceSubsurfaceIndexMap(const AmanziMesh::Mesh& surf_mesh,
+                            const Teuchos::RCP<const AmanziMesh::Mesh>& sub_mesh) {
+    int nsurf_cells = surf_mesh.num_entities(AmanziMesh::CELL,
+            AmanziMesh::Parallel_type::OWNED);
+    const std::vector<int>& face_to_bf = GetFaceToBoundaryFaceMap(sub_mesh);
+
+    faces_.resize(nsurf_cells);
+    boundary_faces_.resize(nsurf_cells);
+    for (int sc=0; sc!=nsurf_cells; ++sc) {
+      AmanziMesh::Entity_ID f = surf_mesh.entity_get_parent(AmanziMesh::CELL, sc);
+      faces_[sc] = f;
+      boundary_faces_[sc] = face_to_bf[f];
+    }
+  }
+
+  // number of owned surface cells
+  int size() const { return faces_.size(); }
+
+  // subsurface face and boundary_face local IDs of each owned surface cell
+  const std::vector<int>& faces() const { return faces_; }
+  const std::vector<int>& boundary_faces() const { return boundary_faces_; }
+
+  // surf_c[sc] = sub[face of sc]
+  void Gather(const CompositeVector& sub, Epetra_MultiVector& surf_c) const {
+    bool is_face;
+    const std::vector<int>& idx = Indices_(sub, is_face);
+    const Epetra_MultiVector& sub_f = *sub.ViewComponent(is_face ? "face" : "boundary_face", false);
+    const double* src = sub_f[0];
+    double* dest = surf_c[0];
+    int n = idx.size();
+    for (int sc=0; sc!=n; ++sc) dest[sc] = src[idx[sc]];
+  }
+
+  // sub[face of sc] = surf_c[sc]
+  void Scatter(const Epetra_MultiVector& surf_c, CompositeVector& sub) const {
+    bool is_face;
+    const std::vector<int>& idx = Indices_(sub, is_face);
+    Epetra_MultiVector& sub_f = *sub.ViewComponent(is_face ? "face" : "boundary_face", false);
+    const double* src = surf_c[0];
+    double* dest = sub_f[0];
+    int n = idx.size();
+    for (int sc=0; sc!=n; ++sc) dest[idx[sc]] = src[sc];
+  }
+
+ private:
+  const std::vector<int>& Indices_(const CompositeVector& sub, bool& is_face) const {
+    is_face = sub.HasComponent("face");
+    if (!is_face && !sub.HasComponent("boundary_face")) {
+      Errors::Message message("Subsurface vector does not have face component.");
+      Exceptions::amanzi_throw(message);
+    }
+    return is_face ? faces_ : boundary_faces_;
+  }
+
+ private:
+  std::vector<int> faces_;
+  std::vector<int> boundary_faces_;
+};
+
+
+// -----------------------------------------------------------------------------
+// Access the index map for a surface mesh and the subsurface mesh it was
+// extracted from.  Built on first use and stored on the surface mesh.
+// -----------------------------------------------------------------------------
+inline const SurfaceSubsurfaceIndexMap&
+GetSurfaceSubsurfaceIndexMap(const Teuchos::RCP<const AmanziMesh::Mesh>& surf_mesh,
+                             const Teuchos::RCP<const AmanziMesh::Mesh>& sub_mesh)
+{
+  const std::string name("surface subsurface index map");
+  auto map = Teuchos::get_optional_extra_data<Teuchos::RCP<SurfaceSubsurfaceIndexMap> >(
+      surf_mesh, name);
+  if (map.is_null()) {
+    Teuchos::RCP<const AmanziMesh::Mesh> mesh_node(surf_mesh);
+    Teuchos::set_extra_data(Teuchos::rcp(new SurfaceSubsurfaceIndexMap(*surf_mesh, sub_mesh)),
+                            name, Teuchos::outArg(mesh_node), Teuchos::PRE_DESTROY);
+    map = Teuchos::get_optional_extra_data<Teuchos::RCP<SurfaceSubsurfaceIndexMap> >(
+        surf_mesh, name);
+  }
+  return **map;
+}
+
+} // namespace
+
+#endif
@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <vector>
+#include <string>
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+#include "Teuchos_RCP.hpp"
+
+#include "AmanziComm.hh"
+#include "GeometricModel.hh"
+#include "MeshFactory.hh"
+#include "BoundaryFunction.hh"
+#include "FunctionConstant.hh"
+#include "MultiFunction.hh"
+#include "errors.hh"
+
+#include "boundary_face_plan.hh"
+
+using namespace Amanzi;
+
+struct BoxMesh {
+  BoxMesh() {
+    auto comm = getDefaultComm();
+
+    Teuchos::Array<double> origin(3, 0.0);
+    Teuchos::Array<double> normal_left(3, 0.0), normal_bottom(3, 0.0);
+    normal_left[0] = -1.0;
+    normal_bottom[2] = -1.0;
+
+    Teuchos::ParameterList regions;
+    Teuchos::ParameterList& left = regions.sublist("left").sublist("region: plane");
+    left.set("point", origin);
+    left.set("normal", normal_left);
+    Teuchos::ParameterList& bottom = regions.sublist("bottom").sublist("region: plane");
+    bottom.set("point", origin);
+    bottom.set("normal", normal_bottom);
+    auto gm = Teuchos::rcp(new AmanziGeometry::GeometricModel(3, regions, *comm));
+
+    AmanziMesh::MeshFactory factory(comm, gm);
+    mesh = factory.create(0.0, 0.0, 0.0, 1.0, 1.0, 1.0, 3, 2, 4);
+  }
+
+  Teuchos::RCP<Functions::BoundaryFunction> CreateBC(const std::vector<std::string>& regions) {
+    auto bc = Teuchos::rcp(new Functions::BoundaryFunction(mesh));
+    Teuchos::RCP<Function> f = Teuchos::rcp(new FunctionConstant(1.0));
+    bc->Define(regions, Teuchos::rcp(new MultiFunction(f)));
+    bc->Finalize();
+    bc->Compute(0.0);
+    return bc;
+  }
+
+  Teuchos::RCP<const AmanziMesh::Mesh> mesh;
+};
+
+
+// Records must agree with the mesh queries they replace.
+TEST_FIXTURE(BoxMesh, BOUNDARY_FACE_PLAN_RECORDS) {
+  BoundaryFacePlan plan(mesh);
+
+  int nfaces = mesh->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::ALL);
+  int nfaces_owned = mesh->num_entities(AmanziMesh::FACE, AmanziMesh::Parallel_type::OWNED);
+  AmanziMesh::Entity_ID_List cells, faces;
+  std::vector<int> dirs;
+  std::vector<int> owned_boundary;
+  for (int f=0; f!=nfaces; ++f) {
+    mesh->face_get_cells(f, AmanziMesh::Parallel_type::ALL, &cells);
+    CHECK_EQUAL(cells.size() == 1, plan.IsBoundary(f));
+    if (cells.size() != 1) {
+      CHECK_THROW(plan.Record(f), Errors::Message);
+      continue;
+    }
+    if (f < nfaces_owned) owned_boundary.push_back(f);
+
+    const BoundaryFaceRecord& rec = plan.Record(f);
+    CHECK_EQUAL(f, rec.f);
+    CHECK_EQUAL(cells[0], rec.c);
+
+    mesh->cell_get_faces_and_dirs(cells[0], &faces, &dirs);
+    int n = std::find(faces.begin(), faces.end(), f) - faces.begin();
+    CHECK(n < faces.size());
+    CHECK_EQUAL(dirs[n], rec.dir);
+  }
+
+  const auto& owned = plan.OwnedRecords();
+  CHECK_EQUAL(owned_boundary.size(), owned.size());
+  for (int i=0; i!=owned.size(); ++i) {
+    CHECK_EQUAL(owned_boundary[i], owned[i].f);
+    CHECK_EQUAL(plan.Record(owned[i].f).c, owned[i].c);
+  }
+}
+
+
+// Records of a BoundaryFunction are in its order of iteration, and are
+// gathered once per function.
+TEST_FIXTURE(BoxMesh, BOUNDARY_FACE_PLAN_FUNCTION_RECORDS) {
+  BoundaryFacePlan plan(mesh);
+  auto bc_left = CreateBC({"left"});
+  auto bc_both = CreateBC({"left", "bottom"});
+
+  const auto& recs_left = plan.Records(*bc_left);
+  const auto& recs_both = plan.Records(*bc_both);
+  CHECK_EQUAL(bc_left->size(), recs_left.size());
+  CHECK_EQUAL(bc_both->size(), recs_both.size());
+  CHECK(recs_left.size() > 0);
+  CHECK(recs_both.size() > recs_left.size());
+
+  int i = 0;
+  for (const auto& bc : *bc_both) {
+    const BoundaryFaceRecord& rec = recs_both[i++];
+    CHECK_EQUAL(bc.first, rec.f);
+    CHECK_EQUAL(plan.Record(bc.first).c, rec.c);
+    CHECK_EQUAL(plan.Record(bc.first).dir, rec.dir);
+  }
+
+  i = 0;
+  for (const auto& bc : *bc_left) {
+    CHECK_EQUAL(bc.first, recs_left[i++].f);
+  }
+
+  // the same records are returned on later calls
+  CHECK(&recs_left == &plan.Records(*bc_left));
+  CHECK(&recs_both == &plan.Records(*bc_both));
+}
@@ -0,0 +1,116 @@
+#include <vector>
+#include "UnitTest++.h"
+
+#include "Teuchos_ParameterList.hpp"
+
+#include "preconditioner_reuse.hh"
+
+using namespace Amanzi;
+
+namespace {
+
+PreconditionerReuse CreatePolicy(int max_reuses=20) {
+  Teuchos::ParameterList plist;
+  plist.set<bool>("reuse preconditioner", true);
+  plist.set<double>("maximum timestep ratio", 1.5);
+  plist.set<double>("maximum contraction", 0.5);
+  plist.set<int>("maximum reuses", max_reuses);
+  return PreconditionerReuse(plist);
+}
+
+} // namespace
+
+
+TEST(PRECONDITIONER_REUSE_DISABLED) {
+  PreconditionerReuse policy;
+  CHECK(!policy.enabled());
+  for (int i=0; i!=5; ++i) {
+    CHECK(policy.Rebuild(1.0));
+    policy.RecordErrorNorm(1.0, 1.0 / (1 << (4*i)));
+  }
+}
+
+
+// Reused while the nonlinear iteration contracts, also across timesteps of
+// similar size.
+TEST(PRECONDITIONER_REUSE_CONTRACTING) {
+  PreconditionerReuse policy = CreatePolicy();
+  CHECK(policy.enabled());
+
+  CHECK(policy.Rebuild(1.0));
+  double norm = 1.0;
+  for (int i=0; i!=4; ++i) {
+    policy.RecordErrorNorm(10.0, norm);
+    norm *= 0.1;
+    CHECK(!policy.Rebuild(1.0));
+  }
+
+  // a new solve, at a similar timestep
+  policy.RecordErrorNorm(11.2, 1.0);
+  CHECK(!policy.Rebuild(1.2));
+}
+
+
+// A stalled contraction forces a rebuild, after which reuse resumes.
+TEST(PRECONDITIONER_REUSE_STALLED) {
+  PreconditionerReuse policy = CreatePolicy();
+  CHECK(policy.Rebuild(1.0));
+  policy.RecordErrorNorm(10.0, 1.0);
+  CHECK(!policy.Rebuild(1.0));
+  policy.RecordErrorNorm(10.0, 0.1);
+  CHECK(!policy.Rebuild(1.0));
+  policy.RecordErrorNorm(10.0, 0.09);
+  CHECK(policy.Rebuild(1.0));
+  CHECK(!policy.Rebuild(1.0));
+}
+
+
+// Timestep changes, the maximum number of reuses, and invalidation.
+TEST(PRECONDITIONER_REUSE_LIMITS) {
+  PreconditionerReuse policy = CreatePolicy(3);
+  CHECK(policy.Rebuild(1.0));
+  CHECK(policy.Rebuild(2.0));
+  CHECK(!policy.Rebuild(1.5));
+  CHECK(policy.Rebuild(1.0));
+
+  CHECK(!policy.Rebuild(1.0));
+  CHECK(!policy.Rebuild(1.0));
+  CHECK(!policy.Rebuild(1.0));
+  CHECK(policy.Rebuild(1.0));
+
+  policy.Invalidate();
+  CHECK(policy.Rebuild(1.0));
+}
+
+
+// As in Richards::UpdatePreconditioner, iterations are counted on every
+// update whether or not it rebuilds, and the Newton correction starts at
+// iteration jacobian_lag.  A preconditioner assembled without the correction
+// must not be reused once it is due.
+TEST(PRECONDITIONER_REUSE_NEWTON_LAG) {
+  PreconditionerReuse policy = CreatePolicy();
+  int jacobian_lag = 2;
+
+  for (int step=0; step!=2; ++step) {
+    double t = 10.0 + step;
+    int iter = 0;
+    std::vector<bool> rebuilds;
+    double norm = 1.0;
+    for (int k=0; k!=5; ++k) {
+      bool newton = iter >= jacobian_lag;
+      rebuilds.push_back(policy.Rebuild(1.0, newton));
+      iter++;
+      policy.RecordErrorNorm(t, norm);
+      norm *= 0.1;
+    }
+    CHECK_EQUAL(5, iter);
+
+    // built without the correction at iteration 0 (reusing the previous
+    // step's would include it), reused, then rebuilt with it when due
+    CHECK(rebuilds[0]);
+    CHECK(!rebuilds[1]);
+    CHECK(rebuilds[2]);
+    CHECK(!rebuilds[3]);
+    CHECK(!rebuilds[4]);
+  }
+}
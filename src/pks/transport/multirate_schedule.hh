@@ -0,0 +1,124 @@
+/*
+  Transport PK
+
+  Copyright 2010-201x held jointly by LANS/LANL, LBNL, and PNNL.
+  Amanzi is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Schedule of a multirate (local time stepping) explicit scheme.
+
+  Cells are binned into power-of-two levels: a cell of level l takes steps
+  of size dt0 * 2^l, where dt0 is the finest step, and a macro step is made
+  of 2^L fine substeps, L being the coarsest level.  A face is advanced at
+  the finer level of its two cells and updates both, so that an exchange
+  across a level interface is conservative.
+
+  Run() drives one macro step, calling functors for the physics:
+
+    start(c, tau)          a step of owned cell c starts at time tau
+    face(f, dt_l)          a step of face f of size dt_l starts
+    substep(tau, dt0, l)   once per fine substep, after face() and before
+                           end(); levels <= l have just started a step
+    end(c, tau)            a step of owned cell c ends at time tau
+    scatter(l)             cells of levels <= l have ended a step, so their
+                           ghosts must be refreshed
+
+  Times tau are measured from the start of the macro step.
+*/
+
+#ifndef AMANZI_ATS_TRANSPORT_MULTIRATE_SCHEDULE_HH_
+#define AMANZI_ATS_TRANSPORT_MULTIRATE_SCHEDULE_HH_
+
+#include <algorithm>
+#include <vector>
+
+#include "dbc.hh"
+
+namespace Amanzi {
+namespace Transport {
+
+class MultirateSchedule {
+ public:
+  MultirateSchedule() : nlevels_(0) {};
+
+  // Bin cells and faces.  cell_level covers owned and ghost cells, and
+  // levels are in [0, max_level].  Either cell of a face may be -1.
+  void Init(const std::vector<int>& cell_level, int ncells_owned, int max_level,
+            const std::vector<int>& upwind_cell, const std::vector<int>& downwind_cell)
+  {
+    AMANZI_ASSERT(upwind_cell.size() == downwind_cell.size());
+    nlevels_ = max_level + 1;
+
+    cells_.assign(nlevels_, std::vector<int>());
+    for (int c = 0; c < ncells_owned; c++) {
+      AMANZI_ASSERT(cell_level[c] >= 0 && cell_level[c] <= max_level);
+      cells_[cell_level[c]].push_back(c);
+    }
+
+    int nfaces = upwind_cell.size();
+    face_level_.assign(nfaces, 0);
+    faces_.assign(nlevels_, std::vector<int>());
+    for (int f = 0; f < nfaces; f++) {
+      int l = max_level;
+      if (upwind_cell[f] >= 0) l = std::min(l, cell_level[upwind_cell[f]]);
+      if (downwind_cell[f] >= 0) l = std::min(l, cell_level[downwind_cell[f]]);
+      face_level_[f] = l;
+      faces_[l].push_back(f);
+    }
+  }
+
+  int num_levels() const { return nlevels_; }
+  int num_substeps() const { return 1 << (nlevels_ - 1); }
+
+  // owned cells and faces of level l
+  const std::vector<int>& cells(int l) const { return cells_[l]; }
+  const std::vector<int>& faces(int l) const { return faces_[l]; }
+  int face_level(int f) const { return face_level_[f]; }
+
+  // Steps of all levels <= StartLevel(k) start at fine substep k, and steps
+  // of all levels <= EndLevel(k) end after it.
+  int StartLevel(int k) const {
+    int l = 0;
+    while (l < nlevels_ - 1 && (k % (1 << (l + 1))) == 0) l++;
+    return l;
+  }
+  int EndLevel(int k) const { return StartLevel(k + 1); }
+
+  template<class Start, class Face, class Substep, class End, class Scatter>
+  void Run(double dt0, const Start& start, const Face& face, const Substep& substep,
+           const End& end, const Scatter& scatter) const
+  {
+    int nsub = num_substeps();
+    double tau = 0.0;
+    for (int k = 0; k < nsub; k++) {
+      int lstart = StartLevel(k);
+      int lend = EndLevel(k);
+
+      for (int l = 0; l <= lstart; l++) {
+        for (int c : cells_[l]) start(c, tau);
+      }
+      for (int l = 0; l <= lstart; l++) {
+        double dt_l = dt0 * (1 << l);
+        for (int f : faces_[l]) face(f, dt_l);
+      }
+      substep(tau, dt0, lstart);
+
+      tau += dt0;
+      for (int l = 0; l <= lend; l++) {
+        for (int c : cells_[l]) end(c, tau);
+      }
+      scatter(lend);
+    }
+  }
+
+ private:
+  int nlevels_;
+  std::vector<int> face_level_;
+  std::vector<std::vector<int> > cells_, faces_;
+};
+
+}  // namespace Transport
+}  // namespace Amanzi
+
+#endif
@@ -25,6 +25,7 @@
 #include "FieldEvaluator.hh"
 #include "GMVMesh.hh"
 #include "Mesh.hh"
+#include "face_cell_adjacency.hh"
 #include "OperatorDefs.hh"
 #include "PDE_DiffusionFactory.hh"
 #include "PDE_Diffusion.hh"
@@ -447,6 +448,32 @@ void SedimentTransport_PK::Initialize(const Teuchos::Ptr<State>& S)
 
   dt_debug_ = tp_list_->get<double>("maximum time step", TRANSPORT_LARGE_TIME_STEP);
 
+  // diffusion operators: the mesh topology and boundary conditions are fixed,
+  // so these are built once and only their coefficients are updated in
+  // Advance_Diffusion().
+  {
+    Teuchos::ParameterList& op_list =
+        tp_list_->sublist("operators").sublist("diffusion operator").sublist("matrix");
+
+    // default boundary conditions (none inside domain and Neumann on its boundary)
+    diff_bcs_ = Teuchos::rcp(new Operators::BCs(mesh_, AmanziMesh::FACE, WhetStone::DOF_Type::SCALAR));
+    PopulateBoundaryData(diff_bcs_->bc_model(), diff_bcs_->bc_value(), -1);
+
+    Operators::PDE_DiffusionFactory opfactory;
+    diff_op_ = opfactory.Create(op_list, mesh_, diff_bcs_);
+    diff_op_->SetBCs(diff_bcs_, diff_bcs_);
+    diff_global_op_ = diff_op_->global_operator();
+    diff_acc_op_ = Teuchos::rcp(new Operators::PDE_Accumulation(AmanziMesh::CELL, diff_global_op_));
+
+    const CompositeVectorSpace& cvs = diff_global_op_->DomainMap();
+    diff_sol_ = Teuchos::rcp(new CompositeVector(cvs));
+    diff_factor_ = Teuchos::rcp(new CompositeVector(cvs));
+
+    // the structure of the inverse is fixed with the topology; its values are
+    // recomputed in Advance_Diffusion()
+    diff_global_op_->InitializeInverse();
+  }
+
   
   if (vo_->getVerbLevel() >= Teuchos::VERB_MEDIUM) {
     Teuchos::OSTab tab = vo_->getOSTab();
@@ -876,37 +903,25 @@ void SedimentTransport_PK :: Advance_Diffusion(double t_old, double t_new) {
   bool flag_diffusion(true);
 
   if (flag_diffusion) {
-    Teuchos::ParameterList& op_list = 
-        tp_list_->sublist("operators").sublist("diffusion operator").sublist("matrix");
-
-    Teuchos::RCP<Operators::BCs> bc_dummy = 
-        Teuchos::rcp(new Operators::BCs(mesh_, AmanziMesh::FACE,  WhetStone::DOF_Type::SCALAR));
-    
-    // default boundary conditions (none inside domain and Neumann on its boundary)
-    auto& bc_model = bc_dummy->bc_model();
-    auto& bc_value = bc_dummy->bc_value();
-    PopulateBoundaryData(bc_model, bc_value, -1);
-
-    Operators::PDE_DiffusionFactory opfactory;
-    Teuchos::RCP<Operators::PDE_Diffusion> op1 = opfactory.Create(op_list, mesh_, bc_dummy);
-    op1->SetBCs(bc_dummy, bc_dummy);
-    Teuchos::RCP<Operators::Operator> op = op1->global_operator();
-    Teuchos::RCP<Operators::PDE_Accumulation> op2 =
-        Teuchos::rcp(new Operators::PDE_Accumulation(AmanziMesh::CELL, op));
-
-    const CompositeVectorSpace& cvs = op->DomainMap();
-    CompositeVector sol(cvs), factor(cvs), factor0(cvs), source(cvs), zero(cvs);
-    zero.PutScalar(0.0);
-  
-    // instantiate solver
+    // operators and work vectors are created in Initialize()
+    Teuchos::RCP<Operators::PDE_Diffusion> op1 = diff_op_;
+    Teuchos::RCP<Operators::Operator> op = diff_global_op_;
+    Teuchos::RCP<Operators::PDE_Accumulation> op2 = diff_acc_op_;
+    CompositeVector& sol = *diff_sol_;
+    CompositeVector& factor = *diff_factor_;
 
     S_inter_->GetFieldEvaluator(horiz_mixing_key_)->HasFieldChanged(S_.ptr(),  horiz_mixing_key_);
 
     CalculateDiffusionTensor_(*km_, *ws_, *mol_dens_);
 
-    int phase, num_itrs(0);
-    bool flag_op1(true);
-    double md_change, md_old(0.0), md_new, residual(0.0);
+    int num_itrs(0);
+    double residual(0.0);
+
+    // accumulation factor is the same for all components
+    Epetra_MultiVector& fac = *factor.ViewComponent("cell");
+    for (int c = 0; c < ncells_owned; c++) {
+      fac[0][c] =  (*ws_)[0][c] * (*mol_dens_)[0][c];
+    }
 
     // Disperse and diffuse aqueous components
     for (int i = 0; i < num_aqueous; i++) {
@@ -925,13 +940,12 @@ void SedimentTransport_PK :: Advance_Diffusion(double t_old, double t_new) {
       op1->UpdateMatrices(Teuchos::null, Teuchos::null);
 
       // add accumulation term
-      Epetra_MultiVector& fac = *factor.ViewComponent("cell");
-      for (int c = 0; c < ncells_owned; c++) {
-        fac[0][c] =  (*ws_)[0][c] * (*mol_dens_)[0][c];
-      }
       op2->AddAccumulationDelta(sol, factor, factor, dt_MPC, "cell");
  
       op1->ApplyBCs(true, true, true);
+
+      // the matrix is the same for all components, only the rhs differs
+      if (i == 0) op->ComputeInverse();
   
       CompositeVector& rhs = *op->rhs();
       int ierr = op->ApplyInverse(rhs, sol);
@@ -1521,30 +1535,30 @@ bool SedimentTransport_PK::PopulateBoundaryData(
 ******************************************************************* */
 void SedimentTransport_PK::IdentifyUpwindCells()
 {
-  for (int f = 0; f < nfaces_wghost; f++) {
-    (*upwind_cell_)[f] = -1;  // negative value indicates boundary
-    (*downwind_cell_)[f] = -1;
+  const Operators::FaceCellAdjacency& adj = Operators::GetFaceCellAdjacency(mesh_);
 
-    }
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> dirs;
+  for (int f = 0; f < nfaces_wghost; f++) {
+    int upwind = -1;  // negative value indicates boundary
+    int downwind = -1;
 
-  for (int c = 0; c < ncells_wghost; c++) {
-    mesh_->cell_get_faces_and_dirs(c, &faces, &dirs);
+    for (int j = 0; j < 2; j++) {
+      int i = adj.sorted_index(f, j);
+      int c = adj.cell(f, i);
+      if (c < 0) continue;
 
-    for (int i = 0; i < faces.size(); i++) {
-      int f = faces[i];
-      double tmp = (*flux_)[0][f] * dirs[i];
+      double tmp = (*flux_)[0][f] * adj.dir(f, i);
       if (tmp > 0.0) {
-        (*upwind_cell_)[f] = c;
+        upwind = c;
       } else if (tmp < 0.0) {
-        (*downwind_cell_)[f] = c;
-      } else if (dirs[i] > 0) {
-        (*upwind_cell_)[f] = c;
+        downwind = c;
+      } else if (adj.dir(f, i) > 0) {
+        upwind = c;
       } else {
-        (*downwind_cell_)[f] = c;
+        downwind = c;
       }
     }
+    (*upwind_cell_)[f] = upwind;
+    (*downwind_cell_)[f] = downwind;
   }
 }
 
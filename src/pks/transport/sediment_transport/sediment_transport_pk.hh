@@ -31,6 +31,10 @@
 #include "VerboseObject.hh"
 #include "PK_PhysicalExplicit.hh"
 #include "DenseVector.hh"
+#include "BCs.hh"
+#include "Operator.hh"
+#include "PDE_Diffusion.hh"
+#include "PDE_Accumulation.hh"
 
 #include <string>
 
@@ -239,6 +243,13 @@ typedef double AnalyticFunction(const AmanziGeometry::Point&, const double);
   std::vector<WhetStone::Tensor> D_;
   std::string diffusion_preconditioner, diffusion_solver;    
 
+  // diffusion operators, created once and refreshed on each step
+  Teuchos::RCP<Operators::BCs> diff_bcs_;
+  Teuchos::RCP<Operators::PDE_Diffusion> diff_op_;
+  Teuchos::RCP<Operators::PDE_Accumulation> diff_acc_op_;
+  Teuchos::RCP<Operators::Operator> diff_global_op_;
+  Teuchos::RCP<CompositeVector> diff_sol_, diff_factor_;
+
   // bool flag_dispersion_;
   // std::vector<int> axi_symmetry_;  // axi-symmetry direction of permeability tensor
   
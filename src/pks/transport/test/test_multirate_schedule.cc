@@ -0,0 +1,134 @@
+#include <cmath>
+#include <vector>
+#include "UnitTest++.h"
+
+#include "multirate_schedule.hh"
+
+using namespace Amanzi::Transport;
+
+// Donor upwind on a 1D chain of cells with a uniform velocity u > 0.  Face
+// f lies between cells f-1 and f; face 0 is an inflow and face ncells an
+// outflow boundary.
+struct Chain {
+  Chain(const std::vector<double>& vol_, double u_, double c_in_) :
+      vol(vol_), u(u_), c_in(c_in_), inflow(0.), outflow(0.)
+  {
+    int ncells = vol.size();
+    for (int f = 0; f <= ncells; f++) {
+      upwind.push_back(f == 0 ? -1 : f - 1);
+      downwind.push_back(f == ncells ? -1 : f);
+    }
+    conc.resize(ncells);
+    for (int c = 0; c < ncells; c++) conc[c] = 1.0 + 0.1 * c;
+    cons.resize(ncells);
+  }
+
+  double mass() const {
+    double m = 0.;
+    for (int c = 0; c != (int) conc.size(); c++) m += conc[c] * vol[c];
+    return m;
+  }
+
+  // one macro step with the schedule, sources of rate src per unit volume
+  void Advance(const MultirateSchedule& sched, double dt0, double src) {
+    auto start = [&](int c, double tau) { cons[c] = conc[c] * vol[c]; };
+    auto face = [&](int f, double dt_l) {
+      int c1 = upwind[f];
+      int c2 = downwind[f];
+      double flux = dt_l * u * (c1 >= 0 ? conc[c1] : c_in);
+      if (c1 >= 0) cons[c1] -= flux;
+      else inflow += flux;
+      if (c2 >= 0) cons[c2] += flux;
+      else outflow += flux;
+    };
+    auto substep = [&](double tau, double dt, int lstart) {
+      for (int c = 0; c != (int) cons.size(); c++) cons[c] += dt * src * vol[c];
+    };
+    auto end = [&](int c, double tau) { conc[c] = cons[c] / vol[c]; };
+    auto scatter = [&](int lend) {};
+    sched.Run(dt0, start, face, substep, end, scatter);
+  }
+
+  std::vector<double> vol;
+  double u, c_in, inflow, outflow;
+  std::vector<int> upwind, downwind;
+  std::vector<double> conc, cons;
+};
+
+
+TEST(MULTIRATE_SUBSTEP_LEVELS) {
+  MultirateSchedule sched;
+  std::vector<int> level = { 0, 1, 2 };
+  std::vector<int> uw = { -1, 0, 1, 2 };
+  std::vector<int> dw = { 0, 1, 2, -1 };
+  sched.Init(level, 3, 2, uw, dw);
+
+  CHECK_EQUAL(3, sched.num_levels());
+  CHECK_EQUAL(4, sched.num_substeps());
+
+  int start[4] = { 2, 0, 1, 0 };
+  int end[4] = { 0, 1, 0, 2 };
+  for (int k = 0; k != 4; ++k) {
+    CHECK_EQUAL(start[k], sched.StartLevel(k));
+    CHECK_EQUAL(end[k], sched.EndLevel(k));
+  }
+
+  // faces take the finer level of their cells
+  CHECK_EQUAL(0, sched.face_level(0));
+  CHECK_EQUAL(0, sched.face_level(1));
+  CHECK_EQUAL(1, sched.face_level(2));
+  CHECK_EQUAL(2, sched.face_level(3));
+}
+
+
+TEST(MULTIRATE_CONSERVES_MASS) {
+  // fine cells in the middle of the chain
+  std::vector<double> vol = { 8., 8., 4., 2., 1., 1., 2., 4., 8., 8. };
+  std::vector<int> level = { 3, 3, 2, 1, 0, 0, 1, 2, 3, 3 };
+  Chain chain(vol, 0.5, 2.0);
+
+  MultirateSchedule sched;
+  sched.Init(level, vol.size(), 3, chain.upwind, chain.downwind);
+
+  double dt0 = 1.0;
+  double src = 0.01;
+  double mass0 = chain.mass();
+  double vol_total = 0.;
+  for (double v : vol) vol_total += v;
+
+  int nmacro = 3;
+  for (int n = 0; n != nmacro; ++n) chain.Advance(sched, dt0, src);
+
+  double dt_total = nmacro * sched.num_substeps() * dt0;
+  double expected = mass0 + chain.inflow - chain.outflow + src * vol_total * dt_total;
+  CHECK_CLOSE(expected, chain.mass(), 1.e-10 * expected);
+  CHECK_CLOSE(2.0 * 0.5 * dt_total, chain.inflow, 1.e-12);
+}
+
+
+TEST(MULTIRATE_SINGLE_LEVEL_EQUALS_GLOBAL) {
+  std::vector<double> vol = { 1., 2., 1., 3., 1. };
+  double u = 0.3, c_in = 2.0, dt = 0.25, src = 0.1;
+
+  // all cells on the finest level of a 3 level schedule: four global steps
+  Chain chain(vol, u, c_in);
+  std::vector<int> level(vol.size(), 0);
+  MultirateSchedule sched;
+  sched.Init(level, vol.size(), 2, chain.upwind, chain.downwind);
+  chain.Advance(sched, dt, src);
+
+  // reference: forward Euler donor upwind with a global step
+  Chain ref(vol, u, c_in);
+  int ncells = vol.size();
+  for (int n = 0; n != 4; ++n) {
+    std::vector<double> old = ref.conc;
+    for (int c = 0; c != ncells; c++) {
+      double in = c == 0 ? c_in : old[c-1];
+      ref.conc[c] = old[c] + dt * (u * (in - old[c]) / vol[c] + src);
+    }
+  }
+
+  for (int c = 0; c != ncells; c++) {
+    CHECK_CLOSE(ref.conc[c], chain.conc[c], 1.e-12);
+  }
+}
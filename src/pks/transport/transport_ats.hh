@@ -45,6 +45,7 @@
 #include "LimiterCell.hh"
 #include "MDMPartition.hh"
 #include "MultiscaleTransportPorosityPartition.hh"
+#include "multirate_schedule.hh"
 #include "TransportDomainFunction.hh"
 #include "TransportDefs.hh"
 
@@ -132,9 +133,11 @@ class Transport_ATS : public PK_PhysicalExplicit<Epetra_Vector> {
 
   void CalculateLpErrors(AnalyticFunction f, double t, Epetra_Vector* sol, double* L1, double* L2);
 
-  // -- sources and sinks for components from n0 to n1 including
+  // -- sources and sinks for components from n0 to n1 including; the
+  //    domain coupling water sink is scaled by coupling_fraction
   void ComputeAddSourceTerms(double tp, double dtp, 
-                             Epetra_MultiVector& tcc, int n0, int n1);
+                             Epetra_MultiVector& tcc, int n0, int n1,
+                             double coupling_fraction=1.0);
 
   // void MixingSolutesWthSources(double told, double tnew);
 
@@ -162,6 +165,10 @@ class Transport_ATS : public PK_PhysicalExplicit<Epetra_Vector> {
   void AdvanceSecondOrderUpwindRK2(double dT);
   void Advance_Dispersion_Diffusion(double t_old, double t_new);
 
+  // -- multirate donor upwind
+  int IdentifyMultirateLevels_(double dt_MPC, double* dt0);
+  int AdvanceDonorUpwindMultirate_(double dt_MPC, double dt_shift, double dt_global);
+
   // time integration members
   void FunctionalTimeDerivative(const double t, const Epetra_Vector& component, Epetra_Vector& f_component);
     //  void FunctionalTimeDerivative(const double t, const Epetra_Vector& component, TreeVector& f_component);
@@ -247,6 +254,15 @@ class Transport_ATS : public PK_PhysicalExplicit<Epetra_Vector> {
   std::string passwd_;
 
   bool subcycling_, water_source_in_meters_;
+
+  // multirate subcycling: cells binned by stable step into power-of-two levels
+  bool multirate_;
+  int multirate_max_level_;
+  std::vector<double> cell_dt_;  // stable step of owned cells, before cfl
+  MultirateSchedule multirate_schedule_;
+  std::vector<std::vector<int> > multirate_ghosts_;  // ghost cells of levels <= l
+  std::vector<Teuchos::RCP<Epetra_Import> > multirate_importers_;
+  std::vector<Teuchos::RCP<Epetra_MultiVector> > multirate_ghost_values_;
   int dim;
   int saturation_name_;
   bool vol_flux_conversion_;
@@ -254,6 +270,8 @@ class Transport_ATS : public PK_PhysicalExplicit<Epetra_Vector> {
   Teuchos::RCP<CompositeVector> tcc_w_src;
   Teuchos::RCP<CompositeVector> tcc_tmp;  // next tcc
   Teuchos::RCP<CompositeVector> tcc;  // smart mirrow of tcc 
+  Teuchos::RCP<CompositeVector> tcc_subcycle_;  // ping-pong buffer for subcycling
+  double bytes_allocated_;  // bytes allocated in the last AdvanceStep
   Teuchos::RCP<Epetra_MultiVector> conserve_qty_, solid_qty_, water_qty_;
   Teuchos::RCP<const Epetra_MultiVector> flux_;
   Teuchos::RCP<const Epetra_MultiVector> ws_, ws_prev_, phi_, mol_dens_, mol_dens_prev_;
@@ -289,6 +307,7 @@ class Transport_ATS : public PK_PhysicalExplicit<Epetra_Vector> {
   std::vector<WhetStone::Tensor> D_;
 
   bool flag_dispersion_;
+  bool reuse_diffusion_operator_;  // one assembly per diffusion coefficient
   std::vector<int> axi_symmetry_;  // axi-symmetry direction of permeability tensor
 
   std::vector<Teuchos::RCP<MaterialProperties> > mat_properties_;  // vector of materials
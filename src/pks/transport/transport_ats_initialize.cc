@@ -39,6 +39,11 @@ void Transport_ATS::InitializeAll_()
   temporal_disc_order = tp_list_->get<int>("temporal discretization order", 1);
   if (temporal_disc_order < 1 || temporal_disc_order > 2) temporal_disc_order = 1;
 
+  if (multirate_ && spatial_disc_order != 1) {
+    Errors::Message msg("Transport PK: \"multirate subcycling\" requires \"spatial discretization order\" = 1.");
+    Exceptions::amanzi_throw(msg);
+  }
+
   num_aqueous = tp_list_->get<int>("number of aqueous components", component_names_.size());
   num_gaseous = tp_list_->get<int>("number of gaseous components", 0);
 
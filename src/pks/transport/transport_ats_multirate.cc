@@ -0,0 +1,266 @@
+/*
+  Transport PK
+
+  Copyright 2010-201x held jointly by LANS/LANL, LBNL, and PNNL.
+  Amanzi is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+
+  Multirate (local time stepping) version of the donor upwind scheme.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "Epetra_IntVector.h"
+#include "Epetra_Map.h"
+
+#include "transport_ats.hh"
+
+namespace Amanzi {
+namespace Transport {
+
+/* *******************************************************************
+* Bin owned cells and faces into power-of-two time step levels.  A cell
+* of level l is advanced with time step dt0 * 2^l, where dt0 is the
+* finest step; a face is advanced at the finer level of its two cells.
+* Returns the number of macro steps of size dt0 * 2^L over dt_MPC.
+******************************************************************* */
+int Transport_ATS::IdentifyMultirateLevels_(double dt_MPC, double* dt0)
+{
+  // the coarsest level is limited by the user and by the MPC step
+  double dt_stable = dt_;
+  int max_level = 0;
+  while (max_level < multirate_max_level_ && dt_stable * (1 << (max_level + 1)) <= dt_MPC) {
+    max_level++;
+  }
+
+  // shrink the finest step so that macro steps exactly fill dt_MPC
+  int nmacro = std::max(1, (int) std::ceil(dt_MPC / (dt_stable * (1 << max_level)) - 1e-10));
+  *dt0 = dt_MPC / nmacro / (1 << max_level);
+
+  // cell levels, including ghosts
+  if (cell_importer == Teuchos::null) {
+    cell_importer = Teuchos::rcp(new Epetra_Import(mesh_->cell_map(true), mesh_->cell_map(false)));
+  }
+  Epetra_IntVector level_owned(mesh_->cell_map(false));
+  Epetra_IntVector level_ghosted(mesh_->cell_map(true));
+  for (int c = 0; c < ncells_owned; c++) {
+    double dt_cell = std::min(cell_dt_[c], dt_debug_) * cfl_;
+    int l = 0;
+    while (l < max_level && *dt0 * (1 << (l + 1)) <= dt_cell) l++;
+    level_owned[c] = l;
+  }
+  level_ghosted.Import(level_owned, *cell_importer, Insert);
+
+  std::vector<int> level(level_ghosted.Values(), level_ghosted.Values() + ncells_wghost);
+  multirate_schedule_.Init(level, ncells_owned, max_level, *upwind_cell_, *downwind_cell_);
+
+  // Ghosts of levels <= l are refreshed whenever level l ends a step, so
+  // each level gets an importer of just those ghosts.
+  const Epetra_BlockMap& cmap_owned = mesh_->cell_map(false);
+  const Epetra_BlockMap& cmap_wghost = mesh_->cell_map(true);
+  int num_components = tcc_tmp->ViewComponent("cell", false)->NumVectors();
+  multirate_ghosts_.assign(max_level + 1, std::vector<int>());
+  multirate_importers_.resize(max_level + 1);
+  multirate_ghost_values_.resize(max_level + 1);
+  for (int l = 0; l <= max_level; l++) {
+    std::vector<int> gids;
+    for (int c = ncells_owned; c < ncells_wghost; c++) {
+      if (level[c] <= l) {
+        multirate_ghosts_[l].push_back(c);
+        gids.push_back(cmap_wghost.GID(c));
+      }
+    }
+    Epetra_Map ghost_map(-1, gids.size(), gids.data(), 0, cmap_owned.Comm());
+    multirate_importers_[l] = Teuchos::rcp(new Epetra_Import(ghost_map, cmap_owned));
+    multirate_ghost_values_[l] = Teuchos::rcp(new Epetra_MultiVector(ghost_map, num_components));
+  }
+  return nmacro;
+}
+
+
+/* *******************************************************************
+* Multirate donor upwind.  Each cell takes forward Euler steps of its own
+* size, with outgoing fluxes computed from its concentration at the start
+* of its step.  Face fluxes are applied to both neighbors at the rate of
+* the finer one, so mass is conserved across level interfaces.  Work and
+* communication per fine substep are proportional to the number of cells,
+* faces and ghosts active at that substep.  Boundary data are updated once
+* per macro step; sources, including the domain coupling water sink, are
+* added in every fine substep, so that each cell receives them in
+* proportion to the length of its step.  Returns the number of fine
+* substeps taken.
+******************************************************************* */
+int Transport_ATS::AdvanceDonorUpwindMultirate_(double dt_MPC, double dt_shift, double dt_global)
+{
+  double dt0;
+  int nmacro = IdentifyMultirateLevels_(dt_MPC, &dt0);
+  int nsub = multirate_schedule_.num_substeps();
+  double dt_macro = dt0 * nsub;
+
+  tcc->ScatterMasterToGhosted("cell");
+  const Epetra_MultiVector& tcc_prev = *tcc->ViewComponent("cell", true);
+  Epetra_MultiVector& tcc_next = *tcc_tmp->ViewComponent("cell", true);
+  const Epetra_MultiVector& tcc_next_owned = *tcc_tmp->ViewComponent("cell", false);
+
+  // We advect only aqueous components.
+  int num_advect = num_aqueous;
+  int num_components = tcc_next.NumVectors();
+  for (int i = 0; i < num_advect; i++) *tcc_next(i) = *tcc_prev(i);
+  conserve_qty_->PutScalar(0.);
+
+  double t_macro = 0.;  // time since t_old of the current macro step
+
+  // water at time t_old + tau, interpolated in the same way as subcycling
+  auto water = [&](int c, double tau) {
+    double a = (dt_shift + t_macro + tau) / dt_global;
+    double ws = (1.0 - a) * (*ws_prev_)[0][c] + a * (*ws_)[0][c];
+    double den = (1.0 - a) * (*mol_dens_prev_)[0][c] + a * (*mol_dens_)[0][c];
+    return mesh_->cell_volume(c) * (*phi_)[0][c] * ws * den;
+  };
+
+  // start of a cell step: conservative state
+  auto start = [&](int c, double tau) {
+    double vol_phi_ws_den = water(c, tau);
+    (*conserve_qty_)[num_components][c] = 0.;
+    (*conserve_qty_)[num_components+1][c] = vol_phi_ws_den;
+
+    for (int i = 0; i < num_advect; i++) {
+      (*conserve_qty_)[i][c] = tcc_next[i][c] * vol_phi_ws_den;
+
+      if (dissolution_) {
+        double a = (dt_shift + t_macro + tau) / dt_global;
+        double ws = (1.0 - a) * (*ws_prev_)[0][c] + a * (*ws_)[0][c];
+        if ((ws > water_tolerance_) && ((*solid_qty_)[i][c] > 0 )) {  // Dissolve solid residual into liquid
+          double add_mass = std::min((*solid_qty_)[i][c], max_tcc_* vol_phi_ws_den - (*conserve_qty_)[i][c]);
+          (*solid_qty_)[i][c] -= add_mass;
+          (*conserve_qty_)[i][c] += add_mass;
+        }
+      }
+    }
+  };
+
+  // face fluxes, applied for the duration of the face's step
+  auto face = [&](int f, double dt_l) {
+    int c1 = (*upwind_cell_)[f];
+    int c2 = (*downwind_cell_)[f];
+    double u = fabs((*flux_)[0][f]);
+
+    if (c1 >= 0 && c1 < ncells_owned) {
+      for (int i = 0; i < num_advect; i++) {
+        double tcc_flux = dt_l * u * tcc_next[i][c1];
+        (*conserve_qty_)[i][c1] -= tcc_flux;
+        if (c2 < 0) mass_solutes_bc_[i] -= tcc_flux;
+      }
+      (*conserve_qty_)[num_components+1][c1] -= dt_l * u;
+    }
+    if (c2 >= 0 && c2 < ncells_owned) {
+      if (c1 >= 0) {
+        for (int i = 0; i < num_advect; i++) {
+          (*conserve_qty_)[i][c2] += dt_l * u * tcc_next[i][c1];
+        }
+      }
+      (*conserve_qty_)[num_components+1][c2] += dt_l * u;
+    }
+  };
+
+  // boundary influx of faces starting a step, and sources over the substep
+  auto substep = [&](double tau, double dt, int lstart) {
+    for (int m = 0; m < bcs_.size(); m++) {
+      std::vector<int>& tcc_index = bcs_[m]->tcc_index();
+      int ncomp = tcc_index.size();
+
+      for (auto it = bcs_[m]->begin(); it != bcs_[m]->end(); ++it) {
+        int f = it->first;
+        if (multirate_schedule_.face_level(f) > lstart) continue;
+
+        std::vector<double>& values = it->second;
+        int c2 = (*downwind_cell_)[f];
+        double dt_l = dt * (1 << multirate_schedule_.face_level(f));
+        double u = fabs((*flux_)[0][f]);
+        if (c2 >= 0) {
+          for (int i = 0; i < ncomp; i++) {
+            int k = tcc_index[i];
+            if (k < num_advect) {
+              double tcc_flux = dt_l * u * values[i];
+              (*conserve_qty_)[k][c2] += tcc_flux;
+              mass_solutes_bc_[k] += tcc_flux;
+            }
+          }
+        }
+      }
+    }
+
+    if (srcs_.size() != 0) {
+      ComputeAddSourceTerms(t_physics_ + tau + dt, dt, *conserve_qty_, 0, num_advect - 1,
+                            dt / dt_macro);
+    }
+  };
+
+  // end of a cell step: recover concentration from new conservative state
+  auto end = [&](int c, double tau) {
+    double water_new = water(c, tau);
+    double water_sink = (*conserve_qty_)[num_components][c];
+    double water_total = water_new + water_sink;
+    AMANZI_ASSERT(water_total >= water_new);
+
+    for (int i = 0; i < num_advect; i++) {
+      if (water_new > water_tolerance_ && (*conserve_qty_)[i][c] > 0) {
+        tcc_next[i][c] = (*conserve_qty_)[i][c] / water_total;
+      } else if (water_sink > water_tolerance_ && (*conserve_qty_)[i][c] > 0) {
+        tcc_next[i][c] = 0.;
+      } else {
+        (*solid_qty_)[i][c] += std::max((*conserve_qty_)[i][c], 0.);
+        (*conserve_qty_)[i][c] = 0.;
+        tcc_next[i][c] = 0.;
+      }
+    }
+  };
+
+  // ghosts of cells that ended a step see their new start-of-step values
+  auto scatter = [&](int lend) {
+    Epetra_MultiVector& ghost_values = *multirate_ghost_values_[lend];
+    ghost_values.Import(tcc_next_owned, *multirate_importers_[lend], Insert);
+    const std::vector<int>& ghosts = multirate_ghosts_[lend];
+    for (int i = 0; i < num_advect; i++) {
+      for (int j = 0; j < ghosts.size(); j++) tcc_next[i][ghosts[j]] = ghost_values[i][j];
+    }
+  };
+
+  for (int n = 0; n < nmacro; n++) {
+    for (int i = 0; i < bcs_.size(); i++) {
+      bcs_[i]->Compute(t_physics_, t_physics_ + dt_macro);
+    }
+    mass_solutes_source_.assign(num_aqueous + num_gaseous, 0.0);
+    mass_solutes_bc_.assign(num_aqueous + num_gaseous, 0.0);
+
+    multirate_schedule_.Run(dt0, start, face, substep, end, scatter);
+
+    // sources were summed over fine substeps
+    for (int i = 0; i < mass_solutes_exact_.size(); i++) {
+      mass_solutes_exact_[i] += mass_solutes_source_[i] * dt0;
+    }
+    t_physics_ += dt_macro;
+    t_macro += dt_macro;
+  }
+  db_->WriteCellVector("tcc_new", tcc_next);
+
+  // statistics output
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    Teuchos::OSTab tab = vo_->getOSTab();
+    *vo_->os() << "multirate: " << multirate_schedule_.num_levels() << " levels, dt_fine="
+               << units_.OutputTime(dt0) << " [sec], owned cells per level:";
+    for (int l = 0; l < multirate_schedule_.num_levels(); l++) *vo_->os() << " " << multirate_schedule_.cells(l).size();
+    *vo_->os() << std::endl;
+  }
+
+  if (internal_tests) {
+    VV_CheckGEDproperty(*tcc_tmp->ViewComponent("cell"));
+  }
+  return nmacro * nsub;
+}
+
+}  // namespace Transport
+}  // namespace Amanzi
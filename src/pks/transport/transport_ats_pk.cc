@@ -24,6 +24,8 @@
 #include "Explicit_TI_RK.hh"
 #include "FieldEvaluator.hh"
 #include "Mesh.hh"
+#include "face_cell_adjacency.hh"
+#include "halo_exchange.hh"
 #include "OperatorDefs.hh"
 #include "PDE_DiffusionFactory.hh"
 #include "PDE_Diffusion.hh"
@@ -68,6 +70,9 @@ Transport_ATS::Transport_ATS(Teuchos::ParameterList& pk_tree,
   }
 
   subcycling_ = tp_list_->get<bool>("transport subcycling", false);
+  multirate_ = subcycling_ && tp_list_->get<bool>("multirate subcycling", false);
+  multirate_max_level_ = tp_list_->get<int>("multirate maximum level", 4);
+  reuse_diffusion_operator_ = tp_list_->get<bool>("reuse diffusion operator across solutes", true);
 
   water_source_in_meters_ = tp_list_->get<bool>("water source in meters", true);
 
@@ -632,12 +637,14 @@ double Transport_ATS::StableTimeStep()
   vol=0;
   dt_ = dt_cell = TRANSPORT_LARGE_TIME_STEP;
   int cmin_dt = 0;
+  if (multirate_) cell_dt_.assign(ncells_owned, TRANSPORT_LARGE_TIME_STEP);
   for (int c = 0; c < ncells_owned; c++) {
     outflux = total_outflux[c];
 
     if ((outflux > 0) && ((*ws_prev_)[0][c]>0) && ((*ws_)[0][c]>0) && ((*phi_)[0][c] > 0 )) {
       vol = mesh_->cell_volume(c);
       dt_cell = vol * (*mol_dens_)[0][c] * (*phi_)[0][c] * std::min( (*ws_prev_)[0][c], (*ws_)[0][c] ) / outflux;
+      if (multirate_) cell_dt_[c] = dt_cell;
     }
     if (dt_cell < dt_) {
       // *vo_->os()<<"Stable step: "<<flux_key_<<" cell "<<c<<" out "<<outflux<<"  dt= "<<dt_cell<<"\n";
@@ -794,7 +801,19 @@ bool Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
     }
   }
 
+  // Subcycles ping-pong between the "subcycling" copy of tcc and a
+  // persistent buffer, so no memory is allocated after the first step.
+  Teuchos::RCP<CompositeVector> tcc_subcycling = tcc_tmp;
+  bool buffer_seeded = false;
+  bytes_allocated_ = 0.;
+
   int ncycles = 0, swap = 1;
+  if (multirate_) {
+    ncycles = AdvanceDonorUpwindMultirate_(dt_MPC, dt_shift, dt_global);
+    if (multiscale_porosity_) AddMultiscalePorosity_(t_old, t_new, t_old, t_new);
+    dt_sum = dt_MPC;
+  }
+
   while (dt_sum < dt_MPC - 1e-6) {
     // update boundary conditions
     time = t_physics_ + dt_cycle / 2;
@@ -856,13 +875,35 @@ bool Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
       AddMultiscalePorosity_(t_old, t_new, t_int1, t_int2);
     }
 
-    if (! final_cycle) {  // rotate concentrations (we need new memory for tcc)
-      tcc = Teuchos::RCP<CompositeVector>(new CompositeVector(*tcc_tmp));
+    if (! final_cycle) {  // rotate concentrations
+      if (tcc_subcycle_ == Teuchos::null) {
+        tcc_subcycle_ = Teuchos::rcp(new CompositeVector(*tcc_tmp));
+        for (CompositeVector::name_iterator comp=tcc_subcycle_->begin();
+             comp!=tcc_subcycle_->end(); ++comp) {
+          const Epetra_MultiVector& vec = *tcc_subcycle_->ViewComponent(*comp, true);
+          bytes_allocated_ += (double) vec.MyLength() * vec.NumVectors() * sizeof(double);
+        }
+        buffer_seeded = true;
+      } else if (! buffer_seeded) {
+        // Advance routines only write advected components of owned cells;
+        // seed the buffer once so the remaining entries match.
+        *tcc_subcycle_ = *tcc_tmp;
+        buffer_seeded = true;
+      }
+      tcc = tcc_tmp;
+      tcc_tmp = (tcc == tcc_subcycling) ? tcc_subcycle_ : tcc_subcycling;
     }
 
     ncycles++;
   }
 
+  // make sure the final solution lives in the "subcycling" copy of tcc
+  if (tcc_tmp != tcc_subcycling) {
+    *tcc_subcycling = *tcc_tmp;
+    tcc = tcc_tmp;
+    tcc_tmp = tcc_subcycling;
+  }
+
   dt_ = dt_stable;  // restore the original time step (just in case)
 
   Epetra_MultiVector& tcc_next = *tcc_tmp->ViewComponent("cell", false);
@@ -883,6 +924,9 @@ bool Transport_ATS::AdvanceStep(double t_old, double t_new, bool reinit)
 
     VV_PrintSoluteExtrema(tcc_next, dt_MPC);
   }
+  if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+    *vo_->os() << "subcycling allocated " << bytes_allocated_ << " bytes" << std::endl;
+  }
   return failed;
 }
 
@@ -938,12 +982,27 @@ void Transport_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new)
       CalculateDispersionTensor_(*flux_, *phi_, *ws_, *mol_dens_);
     }
 
-    int phase, num_itrs(0);
+    int phase, num_itrs(0), num_assemblies(0);
     bool flag_op1(true);
     double md_change, md_old(0.0), md_new, residual(0.0);
 
-    // Disperse and diffuse aqueous components
+    // Disperse and diffuse aqueous components.  If requested, components
+    // are visited in order of their diffusion coefficient, so that each
+    // run of components with the same coefficient is solved with a single
+    // assembled operator; only the right-hand side changes.
+    std::vector<std::pair<double, int> > aqueous_order(num_aqueous);
     for (int i = 0; i < num_aqueous; i++) {
+      FindDiffusionValue(component_names_[i], &md_new, &phase);
+      aqueous_order[i] = std::make_pair(md_new, i);
+    }
+    if (reuse_diffusion_operator_) {
+      std::stable_sort(aqueous_order.begin(), aqueous_order.end(),
+                       [](const std::pair<double, int>& a, const std::pair<double, int>& b) {
+                         return a.first < b.first; });
+    }
+
+    for (const auto& entry : aqueous_order) {
+      int i = entry.second;
       FindDiffusionValue(component_names_[i], &md_new, &phase);
       md_change = md_new - md_old;
       md_old = md_new;
@@ -976,6 +1035,8 @@ void Transport_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new)
         op2->AddAccumulationDelta(sol, factor, factor, dt_MPC, "cell");
         op1->ApplyBCs(true, true, true);
 
+        num_assemblies++;
+        flag_op1 = !reuse_diffusion_operator_;
       } else {
         Epetra_MultiVector& rhs_cell = *op->rhs()->ViewComponent("cell");
         for (int c = 0; c < ncells_owned; c++) {
@@ -1081,6 +1142,11 @@ void Transport_ATS :: Advance_Dispersion_Diffusion(double t_old, double t_new)
       *vo_->os() << "dispersion solver ||r||=" << residual / num_components
                  << " itrs=" << num_itrs / num_components << std::endl;
     }
+    if (vo_->os_OK(Teuchos::VERB_HIGH)) {
+      Teuchos::OSTab tab = vo_->getOSTab();
+      *vo_->os() << "dispersion operator assembled " << num_assemblies << " times for "
+                 << num_aqueous << " aqueous components" << std::endl;
+    }
   }
 
 }
@@ -1191,10 +1257,11 @@ void Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
   mass_solutes_source_.assign(num_aqueous + num_gaseous, 0.0);
   mass_solutes_bc_.assign(num_aqueous + num_gaseous, 0.0);
 
-  // populating next state of concentrations
-  tcc->ScatterMasterToGhosted("cell");
+  // populating next state of concentrations; ghosts are communicated while
+  // owned cells and interior faces are processed
   Epetra_MultiVector& tcc_prev = *tcc->ViewComponent("cell", true);
   Epetra_MultiVector& tcc_next = *tcc_tmp->ViewComponent("cell", true);
+  Operators::ScopedHaloExchange halo(Operators::GetHaloExchange(mesh_, AmanziMesh::CELL), tcc_prev);
 
   // prepare conservative state in master and slave cells
   double mass_start = 0., tmp1, mass;
@@ -1228,7 +1295,7 @@ void Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
   mesh_->get_comm()->SumAll(&tmp1, &mass_start, 1);
 
   // advance all components at once
-  for (int f = 0; f < nfaces_wghost; f++) {  // loop over master and slave faces
+  auto advect = [&](int f) {
     int c1 = (*upwind_cell_)[f];
     int c2 = (*downwind_cell_)[f];
     double u = fabs((*flux_)[0][f]);
@@ -1264,7 +1331,14 @@ void Transport_ATS::AdvanceDonorUpwind(double dt_cycle)
     } else if (c1 < 0 && c2 >= 0 && c2 < ncells_owned) {
       (*conserve_qty_)[num_components+1][c2] += dt_ * u;
     }
-  }
+  };
+
+  const Operators::FaceCellAdjacency& adj = Operators::GetFaceCellAdjacency(mesh_);
+  for (int f : adj.interior_faces()) advect(f);
+
+  halo.End();
+  for (int f : adj.halo_faces()) advect(f);
+  for (int f = nfaces_owned; f < nfaces_wghost; f++) advect(f);  // slave faces
 
   // loop over exterior boundary sets
   for (int m = 0; m < bcs_.size(); m++) {
@@ -1586,9 +1660,12 @@ void Transport_ATS::AdvanceSecondOrderUpwindRK2(double dt_cycle)
 * Computes source and sink terms and adds them to vector tcc.
 * Returns mass rate for the tracer.
 * The routine treats two cases of tcc with one and all components.
+* The domain coupling water sink is a per-step amount, so a step split
+* into substeps passes the fraction of it falling in each substep.
 ****************************************************************** */
 void Transport_ATS::ComputeAddSourceTerms(double tp, double dtp,
-                                         Epetra_MultiVector& cons_qty, int n0, int n1)
+                                         Epetra_MultiVector& cons_qty, int n0, int n1,
+                                         double coupling_fraction)
 {
   int num_vectors = cons_qty.NumVectors();
   int nsrcs = srcs_.size();
@@ -1606,7 +1683,7 @@ void Transport_ATS::ComputeAddSourceTerms(double tp, double dtp,
       if (c >= ncells_owned) continue;
 
       if (srcs_[m]->name() == "domain coupling" && n0 == 0) {
-        (*conserve_qty_)[component_names_.size()][c] += values[component_names_.size()];
+        (*conserve_qty_)[component_names_.size()][c] += coupling_fraction * values[component_names_.size()];
       }
 
       for (int k = 0; k < tcc_index.size(); ++k) {
@@ -1718,29 +1795,30 @@ bool Transport_ATS::PopulateBoundaryData(
 ******************************************************************* */
 void Transport_ATS::IdentifyUpwindCells()
 {
+  const Operators::FaceCellAdjacency& adj = Operators::GetFaceCellAdjacency(mesh_);
+
   for (int f = 0; f < nfaces_wghost; f++) {
-    (*upwind_cell_)[f] = -1;  // negative value indicates boundary
-    (*downwind_cell_)[f] = -1;
-  }
+    int upwind = -1;  // negative value indicates boundary
+    int downwind = -1;
 
-  AmanziMesh::Entity_ID_List faces;
-  std::vector<int> dirs;
-  for (int c = 0; c < ncells_wghost; c++) {
-    mesh_->cell_get_faces_and_dirs(c, &faces, &dirs);
+    for (int j = 0; j < 2; j++) {
+      int i = adj.sorted_index(f, j);
+      int c = adj.cell(f, i);
+      if (c < 0) continue;
 
-    for (int i = 0; i < faces.size(); i++) {
-      int f = faces[i];
-      double tmp = (*flux_)[0][f] * dirs[i];
+      double tmp = (*flux_)[0][f] * adj.dir(f, i);
       if (tmp > 0.0) {
-        (*upwind_cell_)[f] = c;
+        upwind = c;
       } else if (tmp < 0.0) {
-        (*downwind_cell_)[f] = c;
-      } else if (dirs[i] > 0) {
-        (*upwind_cell_)[f] = c;
+        downwind = c;
+      } else if (adj.dir(f, i) > 0) {
+        upwind = c;
       } else {
-        (*downwind_cell_)[f] = c;
+        downwind = c;
       }
     }
+    (*upwind_cell_)[f] = upwind;
+    (*downwind_cell_)[f] = downwind;
   }
 }
 
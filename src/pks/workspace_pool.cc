@@ -0,0 +1,53 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! A keyed pool of scratch vectors, reused across calls.
+
+#include "errors.hh"
+#include "workspace_pool.hh"
+
+namespace Amanzi {
+
+Teuchos::RCP<CompositeVector>
+WorkspacePool::Get(const std::string& name, const CompositeVectorSpace& space)
+{
+  Teuchos::RCP<CompositeVector>& vec = cvs_[name];
+  if (vec != Teuchos::null) {
+    if (vec.strong_count() > 1) {
+      Errors::Message msg;
+      msg << "WorkspacePool: vector \"" << name << "\" is already checked out.";
+      Exceptions::amanzi_throw(msg);
+    }
+    if (vec->Map().SameAs(space)) return vec;
+  }
+
+  vec = Teuchos::rcp(new CompositeVector(space));
+  allocations_++;
+  return vec;
+}
+
+
+Teuchos::RCP<Epetra_MultiVector>
+WorkspacePool::Get(const std::string& name, const Epetra_BlockMap& map, int num_vectors)
+{
+  Teuchos::RCP<Epetra_MultiVector>& vec = mvs_[name];
+  if (vec != Teuchos::null) {
+    if (vec.strong_count() > 1) {
+      Errors::Message msg;
+      msg << "WorkspacePool: vector \"" << name << "\" is already checked out.";
+      Exceptions::amanzi_throw(msg);
+    }
+    if (vec->NumVectors() == num_vectors &&
+        (vec->Map().PointSameAs(map) || vec->Map().SameAs(map))) return vec;
+  }
+
+  vec = Teuchos::rcp(new Epetra_MultiVector(map, num_vectors, false));
+  allocations_++;
+  return vec;
+}
+
+} // namespace
@@ -0,0 +1,69 @@
+/* -*-  mode: c++; indent-tabs-mode: nil -*- */
+/*
+  ATS is released under the three-clause BSD License.
+  The terms of use and "as is" disclaimer for this license are
+  provided in the top-level COPYRIGHT file.
+*/
+
+//! A keyed pool of scratch vectors, reused across calls.
+
+/*
+  Residual and preconditioner evaluations frequently need temporary vectors
+  whose layout does not change from one call to the next.  Rather than
+  allocating these on every call, a PK checks them out of its pool by name:
+
+    Teuchos::RCP<CompositeVector> tmp = workspace_.Get("adv_flux", flux->Map());
+
+  The vector is allocated the first time, and reused in later calls as long as
+  the space is the same.  It is checked out for as long as the returned RCP
+  lives, and checking out the same name twice at once is an error.  Contents
+  are NOT initialized on reuse.
+
+  The number of allocations is counted, so that steady iterations can be
+  checked to make none.
+*/
+
+#ifndef ATS_WORKSPACE_POOL_HH_
+#define ATS_WORKSPACE_POOL_HH_
+
+#include <map>
+#include <string>
+
+#include "Teuchos_RCP.hpp"
+#include "Epetra_BlockMap.h"
+#include "Epetra_MultiVector.h"
+
+#include "CompositeVector.hh"
+#include "CompositeVectorSpace.hh"
+
+namespace Amanzi {
+
+class WorkspacePool {
+
+ public:
+  WorkspacePool() : allocations_(0) {}
+
+  // Check out a CompositeVector on this space.
+  Teuchos::RCP<CompositeVector>
+  Get(const std::string& name, const CompositeVectorSpace& space);
+
+  // Check out an Epetra_MultiVector on this map.
+  Teuchos::RCP<Epetra_MultiVector>
+  Get(const std::string& name, const Epetra_BlockMap& map, int num_vectors);
+
+  // Number of allocations since the last call, resetting the count.
+  int TakeAllocationCount() {
+    int n = allocations_;
+    allocations_ = 0;
+    return n;
+  }
+
+ private:
+  std::map<std::string, Teuchos::RCP<CompositeVector> > cvs_;
+  std::map<std::string, Teuchos::RCP<Epetra_MultiVector> > mvs_;
+  int allocations_;
+};
+
+} // namespace
+
+#endif
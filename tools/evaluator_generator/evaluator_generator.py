@@ -87,20 +87,23 @@ class EvalGen(object):
     def renderKeyCompositeVector(self):
         return '\n'.join([render('evaluator_keyCompositeVector.cc', dict(arg=arg,var=var)) for arg,var in zip(self.args,self.vars)])        
 
-    def renderKeyEpetraVector(self):
-        return '\n'.join([render('evaluator_keyEpetraVector.cc', dict(arg=arg,var=var)) for arg,var in zip(self.args,self.vars)])        
-    def renderKeyEpetraVectorIndented(self):
-        return '\n'.join([render('evaluator_keyEpetraVectorIndented.cc', dict(arg=arg,var=var)) for arg,var in zip(self.args,self.vars)])        
+    def renderKeyPointer(self):
+        return '\n'.join([render('evaluator_keyPointer.cc', dict(arg=arg,var=var)) for arg,var in zip(self.args,self.vars)])
+    def renderKeyPointerIndented(self):
+        return '\n'.join([render('evaluator_keyPointerIndented.cc', dict(arg=arg,var=var)) for arg,var in zip(self.args,self.vars)])
+
+    def wrtMethod(self, arg):
+        return ''.join([word[0].upper()+word[1:] for word in arg.split("_")])
 
     def renderMyMethodArgs(self):
-        return ", ".join(["%s_v[0][i]"%var for var in self.vars])
+        return ", ".join(["%s_v[i]"%var for var in self.vars])
 
     def renderMyMethodDeclarationArgs(self):
         return ", ".join(["double %s"%var for var in self.vars])
 
     def renderEvaluateModel(self):
         d = dict()
-        d['keyEpetraVectorList'] = self.renderKeyEpetraVector()
+        d['keyPointerList'] = self.renderKeyPointer()
         d['myKeyMethod'] = self.d['myKeyMethod']
         d['myMethodArgs'] = self.renderMyMethodArgs()
         return render('evaluator_evaluateModel.cc', d)
@@ -108,31 +111,27 @@ class EvalGen(object):
     def renderEvaluateDerivs(self):
         wrt_list = []
 
-        def getDict(arg,var):
+        def getDict(i,arg,var):
             d = dict(arg=arg,var=var)
-            d['keyEpetraVectorList'] = self.renderKeyEpetraVectorIndented()
+            d['keyPointerList'] = self.renderKeyPointerIndented()
             d['myKeyMethod'] = self.d['myKeyMethod']
-            d['wrtMethod'] = ''.join([word[0].upper()+word[1:] for word in arg.split("_")])
+            d['wrtMethod'] = self.wrtMethod(arg)
             d['myMethodArgs'] = self.renderMyMethodArgs()
-            return d
-        
-        if len(self.args) > 0:
-            d = getDict(self.args[0], self.vars[0])
-            d['if_elseif'] = render('evaluator_ifWRT.cc', d)
-            wrt_list.append(render('evaluator_evaluateDerivs.cc', d))
-
-        if len(self.args) > 1:
-            for arg,var in zip(self.args[1:],self.vars[1:]):
-                d = getDict(arg,var)
+            if i == 0:
+                d['if_elseif'] = render('evaluator_ifWRT.cc', d)
+            else:
                 d['if_elseif'] = render('evaluator_elseifWRT.cc', d)
-                wrt_list.append(render('evaluator_evaluateDerivs.cc', d))
+            return d
+
+        for i,(arg,var) in enumerate(zip(self.args,self.vars)):
+            wrt_list.append(render('evaluator_evaluateDerivs.cc', getDict(i,arg,var)))
 
         wrt_list.append('\n'.join(["  } else {",
-                                   "    ASSERT(0);",
+                                   "    AMANZI_ASSERT(0);",
                                    "  }"]))
 
         return "\n\n".join(wrt_list)
-                            
+
     def renderModelMethodDeclaration(self):
         return render('model_declaration.hh', dict(myMethod=self.d['myKeyMethod'],
                                                    myMethodDeclarationArgs=self.d['myMethodDeclarationArgs']))
@@ -231,6 +230,11 @@ def generate_evaluator(name, namespace, descriptor, my_key, dependencies, parame
 
       directory: directory where output files are created
 
+    The generated evaluator streams over raw component pointers, and
+    computes only the partial derivative with respect to the requested
+    dependency.  Model methods are defined inline in the model header so
+    that these loops can inline them.
+
     Outputs:
       writes files: [name]_evaluator.hh
                     [name]_evaluator.cc
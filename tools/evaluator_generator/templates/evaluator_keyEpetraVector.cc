@@ -1 +0,0 @@
-    const Epetra_MultiVector& {var}_v = *{var}->ViewComponent(*comp, false);
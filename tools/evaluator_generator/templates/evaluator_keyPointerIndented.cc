@@ -0,0 +1 @@
+      const double* __restrict {var}_v = (*{var}->ViewComponent(*comp, false))[0];
@@ -10,6 +10,9 @@
 #ifndef AMANZI_{namespaceCaps}_{evalNameCaps}_MODEL_HH_
 #define AMANZI_{namespaceCaps}_{evalNameCaps}_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {{
 namespace {namespace} {{
 namespace Relations {{
@@ -33,6 +36,14 @@ class {evalClassName}Model {{
 
 }};
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+{modelMethodImplementation}
+
+{modelDerivImplementationList}
+
 }} //namespace
 }} //namespace
 }} //namespace
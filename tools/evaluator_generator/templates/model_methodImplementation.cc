@@ -1,4 +1,4 @@
-double
+inline double
 {evalClassName}Model::{myMethod}({myMethodDeclarationArgs}) const
 {{
   return {myMethodImplementation};
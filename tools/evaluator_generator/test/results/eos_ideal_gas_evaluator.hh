@@ -2,20 +2,7 @@
   The ideal gas equation of state evaluator is an algebraic evaluator of a given model.
 
   Generated via evaluator_generator with:
-    modelInitializeParamsList =   cv_ = plist.get<double>("heat capacity");
-    evalName = eos_ideal_gas
-    modelMethodDeclaration =   double Density(double temp, double pres) const;
-    namespaceCaps = GENERAL
-    namespace = General
-    paramDeclarationList =   double cv_;
-    evalNameCaps = EOS_IDEAL_GAS
-    myMethodArgs = temp_v[0][i], pres_v[0][i]
-    myKeyMethod = Density
-    myKeyFirst = density
-    evalNameString = ideal gas equation of state
-    myMethodDeclarationArgs = double temp, double pres
-    evalClassName = EosIdealGas
-    myKey = density
+
     
   Authors: Ethan Coon (ecoon@lanl.gov)
 */
@@ -2,20 +2,7 @@
   The ideal gas equation of state model is an algebraic model with dependencies.
 
   Generated via evaluator_generator with:
-    modelInitializeParamsList =   cv_ = plist.get<double>("heat capacity");
-    evalName = eos_ideal_gas
-    modelMethodDeclaration =   double Density(double temp, double pres) const;
-    namespaceCaps = GENERAL
-    namespace = General
-    paramDeclarationList =   double cv_;
-    evalNameCaps = EOS_IDEAL_GAS
-    myMethodArgs = temp_v[0][i], pres_v[0][i]
-    myKeyMethod = Density
-    myKeyFirst = density
-    evalNameString = ideal gas equation of state
-    myMethodDeclarationArgs = double temp, double pres
-    evalClassName = EosIdealGas
-    myKey = density
+
     
   Authors: Ethan Coon (ecoon@lanl.gov)
 */
@@ -23,6 +10,9 @@
 #ifndef AMANZI_GENERAL_EOS_IDEAL_GAS_MODEL_HH_
 #define AMANZI_GENERAL_EOS_IDEAL_GAS_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace General {
 namespace Relations {
@@ -47,6 +37,28 @@ class EosIdealGasModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+EosIdealGasModel::Density(double temp, double pres) const
+{
+  return ASSERT(False);
+}
+
+inline double
+EosIdealGasModel::DDensityDTemperature(double temp, double pres) const
+{
+  return ASSERT(False);
+}
+
+inline double
+EosIdealGasModel::DDensityDPressure(double temp, double pres) const
+{
+  return ASSERT(False);
+}
+
 } //namespace
 } //namespace
 } //namespace
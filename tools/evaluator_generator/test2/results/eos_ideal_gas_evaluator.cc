@@ -43,17 +43,15 @@ EosIdealGasEvaluator::InitializeFromPlist_()
 {
   // Set up my dependencies
   // - defaults to prefixed via domain
-  Key domain_name = Keys::getDomainPrefix(my_key_);
+  Key domain_name = Keys::getDomain(my_key_);
 
   // - pull Keys from plist
   // dependency: temperature
-  temp_key_ = plist_.get<std::string>("temperature key",
-          domain_name+"temperature");
+  temp_key_ = Keys::readKey(plist_, domain_name, "temperature", "temperature");
   dependencies_.insert(temp_key_);
 
   // dependency: pressure
-  pres_key_ = plist_.get<std::string>("pressure key",
-          domain_name+"pressure");
+  pres_key_ = Keys::readKey(plist_, domain_name, "pressure", "pressure");
   dependencies_.insert(pres_key_);
 }
 
@@ -67,13 +65,13 @@ Teuchos::RCP<const CompositeVector> pres = S->GetFieldData(pres_key_);
 
   for (CompositeVector::name_iterator comp=result->begin();
        comp!=result->end(); ++comp) {
-    const Epetra_MultiVector& temp_v = *temp->ViewComponent(*comp, false);
-    const Epetra_MultiVector& pres_v = *pres->ViewComponent(*comp, false);
-    Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+    const double* __restrict temp_v = (*temp->ViewComponent(*comp, false))[0];
+    const double* __restrict pres_v = (*pres->ViewComponent(*comp, false))[0];
+    double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
     int ncomp = result->size(*comp, false);
     for (int i=0; i!=ncomp; ++i) {
-      result_v[0][i] = model_->Density(temp_v[0][i], pres_v[0][i]);
+      result_v[i] = model_->Density(temp_v[i], pres_v[i]);
     }
   }
 }
@@ -89,26 +87,26 @@ Teuchos::RCP<const CompositeVector> pres = S->GetFieldData(pres_key_);
   if (wrt_key == temp_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& temp_v = *temp->ViewComponent(*comp, false);
-      const Epetra_MultiVector& pres_v = *pres->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict temp_v = (*temp->ViewComponent(*comp, false))[0];
+      const double* __restrict pres_v = (*pres->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DDensityDTemperature(temp_v[0][i], pres_v[0][i]);
+        result_v[i] = model_->DDensityDTemperature(temp_v[i], pres_v[i]);
       }
     }
 
   } else if (wrt_key == pres_key_) {
     for (CompositeVector::name_iterator comp=result->begin();
          comp!=result->end(); ++comp) {
-      const Epetra_MultiVector& temp_v = *temp->ViewComponent(*comp, false);
-      const Epetra_MultiVector& pres_v = *pres->ViewComponent(*comp, false);
-      Epetra_MultiVector& result_v = *result->ViewComponent(*comp,false);
+      const double* __restrict temp_v = (*temp->ViewComponent(*comp, false))[0];
+      const double* __restrict pres_v = (*pres->ViewComponent(*comp, false))[0];
+      double* __restrict result_v = (*result->ViewComponent(*comp, false))[0];
 
       int ncomp = result->size(*comp, false);
       for (int i=0; i!=ncomp; ++i) {
-        result_v[0][i] = model_->DDensityDPressure(temp_v[0][i], pres_v[0][i]);
+        result_v[i] = model_->DDensityDPressure(temp_v[i], pres_v[i]);
       }
     }
 
@@ -10,6 +10,9 @@
 #ifndef AMANZI_GENERAL_EOS_IDEAL_GAS_MODEL_HH_
 #define AMANZI_GENERAL_EOS_IDEAL_GAS_MODEL_HH_
 
+#include <cmath>
+#include "dbc.hh"
+
 namespace Amanzi {
 namespace General {
 namespace Relations {
@@ -35,6 +38,28 @@ class EosIdealGasModel {
 
 };
 
+
+// Methods are defined inline so that evaluator loops can inline them.
+
+// main method
+inline double
+EosIdealGasModel::Density(double temp, double pres) const
+{
+  return cv_*(-T0_ + temp);
+}
+
+inline double
+EosIdealGasModel::DDensityDTemperature(double temp, double pres) const
+{
+  return cv_;
+}
+
+inline double
+EosIdealGasModel::DDensityDPressure(double temp, double pres) const
+{
+  return 0;
+}
+
 } //namespace
 } //namespace
 } //namespace